@@ -98,6 +98,9 @@ get_required_kitsune_lib_repo "libKitsunemimiIni" "develop" 1
 
 if [ $1 = "test" ]; then
     build_kitsune_lib_repo "libKitsunemimiConfig" 4 "run_tests"
+elif [ $1 = "benchmark" ]; then
+    build_kitsune_lib_repo "libKitsunemimiConfig" 4 "run_tests"
+    $BUILD_DIR/libKitsunemimiConfig/tests/benchmark_tests/benchmark_tests
 else
     build_kitsune_lib_repo "libKitsunemimiConfig" 4 ""
 fi
@@ -1,2 +1,7 @@
 INCLUDEPATH += $$PWD/src \
                $$PWD/include
+
+# build with "CONFIG += config_access_stats" to count the reads of each item by the getter
+config_access_stats {
+    DEFINES += KITSUNEMIMI_CONFIG_ACCESS_STATS
+}
@@ -0,0 +1,349 @@
+/**
+ *  @file       config_binding.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_BINDING_H
+#define CONFIG_BINDING_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <libKitsunemimiConfig/config_handler.h>
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief connection between an item of a config-group and a member of a struct. The type of the
+ *        item is given by the type of the member.
+ */
+template<typename STRUCT>
+struct ConfigField
+{
+    ConfigField(const std::string &itemName,
+                std::string STRUCT::* member,
+                const bool required = false)
+        : itemName(itemName),
+          type(ConfigHandler::STRING_TYPE),
+          required(required),
+          stringMember(member) {}
+
+    ConfigField(const std::string &itemName,
+                long STRUCT::* member,
+                const bool required = false)
+        : itemName(itemName),
+          type(ConfigHandler::INT_TYPE),
+          required(required),
+          intMember(member) {}
+
+    ConfigField(const std::string &itemName,
+                double STRUCT::* member,
+                const bool required = false)
+        : itemName(itemName),
+          type(ConfigHandler::FLOAT_TYPE),
+          required(required),
+          floatMember(member) {}
+
+    ConfigField(const std::string &itemName,
+                bool STRUCT::* member,
+                const bool required = false)
+        : itemName(itemName),
+          type(ConfigHandler::BOOL_TYPE),
+          required(required),
+          boolMember(member) {}
+
+    ConfigField(const std::string &itemName,
+                std::vector<std::string> STRUCT::* member,
+                const bool required = false)
+        : itemName(itemName),
+          type(ConfigHandler::STRING_ARRAY_TYPE),
+          required(required),
+          stringArrayMember(member) {}
+
+    ConfigField(const std::string &itemName,
+                std::chrono::nanoseconds STRUCT::* member,
+                const bool required = false)
+        : itemName(itemName),
+          type(ConfigHandler::DURATION_TYPE),
+          required(required),
+          durationMember(member) {}
+
+    ConfigField(const std::string &itemName,
+                uint64_t STRUCT::* member,
+                const bool required = false)
+        : itemName(itemName),
+          type(ConfigHandler::BYTE_SIZE_TYPE),
+          required(required),
+          byteSizeMember(member) {}
+
+    std::string itemName = "";
+    ConfigHandler::ConfigType type = ConfigHandler::UNDEFINED_TYPE;
+    bool required = false;
+
+    std::string STRUCT::* stringMember = nullptr;
+    long STRUCT::* intMember = nullptr;
+    double STRUCT::* floatMember = nullptr;
+    bool STRUCT::* boolMember = nullptr;
+    std::vector<std::string> STRUCT::* stringArrayMember = nullptr;
+    std::chrono::nanoseconds STRUCT::* durationMember = nullptr;
+    uint64_t STRUCT::* byteSizeMember = nullptr;
+
+    // index of the registered value
+    uint32_t index = UNREGISTERED_CONFIG_KEY;
+};
+
+//==================================================================================================
+
+/**
+ * @brief all items of a config-group, which are bound to the members of a struct. The items are
+ *        registered and type-checked only once, when the binding is created. Loading the struct
+ *        afterwards reads all values with their handles and from the same config-state, so the
+ *        struct is never filled with a mix of old and new values while a reload is running.
+ */
+template<typename STRUCT>
+class ConfigBinding
+{
+public:
+    ConfigBinding() {}
+
+    ConfigBinding(ConfigHandler* configHandler,
+                  const std::vector<ConfigField<STRUCT>> &fields,
+                  const bool valid)
+        : m_configHandler(configHandler),
+          m_fields(fields),
+          m_valid(valid) {}
+
+    /**
+     * @brief check if all fields were registered successfully
+     */
+    bool
+    isValid() const
+    {
+        return m_valid;
+    }
+
+    /**
+     * @brief fill all bound members of a struct with the current values of the config
+     *
+     * @param target struct to fill
+     *
+     * @return false, if the binding is invalid, else true. Members of fields, which failed at
+     *         the registration, are not touched.
+     */
+    bool
+    load(STRUCT &target) const
+    {
+        if(m_configHandler == nullptr) {
+            return false;
+        }
+
+        bool success = false;
+        ConfigHandler::SnapshotReader reader(m_configHandler);
+
+        for(const ConfigField<STRUCT> &field : m_fields)
+        {
+            switch(field.type)
+            {
+                case ConfigHandler::STRING_TYPE:
+                {
+                    const ConfigKey<std::string> key = {field.index};
+                    std::string value = reader.getString(key, success);
+                    if(success) {
+                        target.*field.stringMember = std::move(value);
+                    }
+                    break;
+                }
+                case ConfigHandler::INT_TYPE:
+                {
+                    const ConfigKey<long> key = {field.index};
+                    const long value = reader.getInteger(key, success);
+                    if(success) {
+                        target.*field.intMember = value;
+                    }
+                    break;
+                }
+                case ConfigHandler::FLOAT_TYPE:
+                {
+                    const ConfigKey<double> key = {field.index};
+                    const double value = reader.getFloat(key, success);
+                    if(success) {
+                        target.*field.floatMember = value;
+                    }
+                    break;
+                }
+                case ConfigHandler::BOOL_TYPE:
+                {
+                    const ConfigKey<bool> key = {field.index};
+                    const bool value = reader.getBoolean(key, success);
+                    if(success) {
+                        target.*field.boolMember = value;
+                    }
+                    break;
+                }
+                case ConfigHandler::STRING_ARRAY_TYPE:
+                {
+                    const ConfigKey<std::vector<std::string>> key = {field.index};
+                    std::vector<std::string> value = reader.getStringArray(key, success);
+                    if(success) {
+                        target.*field.stringArrayMember = std::move(value);
+                    }
+                    break;
+                }
+                case ConfigHandler::DURATION_TYPE:
+                {
+                    const ConfigKey<std::chrono::nanoseconds> key = {field.index};
+                    const std::chrono::nanoseconds value = reader.getDuration(key, success);
+                    if(success) {
+                        target.*field.durationMember = value;
+                    }
+                    break;
+                }
+                case ConfigHandler::BYTE_SIZE_TYPE:
+                {
+                    const ConfigKey<uint64_t> key = {field.index};
+                    const uint64_t value = reader.getByteSize(key, success);
+                    if(success) {
+                        target.*field.byteSizeMember = value;
+                    }
+                    break;
+                }
+                case ConfigHandler::UNDEFINED_TYPE:
+                    break;
+            }
+        }
+
+        return m_valid;
+    }
+
+private:
+    ConfigHandler* m_configHandler = nullptr;
+    std::vector<ConfigField<STRUCT>> m_fields;
+    bool m_valid = false;
+};
+
+//==================================================================================================
+
+/**
+ * @brief register all fields of a struct as items of a config-group. The default-values of the
+ *        items are the values of the members of a default-constructed struct.
+ *
+ *        struct ServerSettings
+ *        {
+ *            std::string host = "localhost";
+ *            long port = 8080;
+ *        };
+ *
+ *        ConfigBinding<ServerSettings> binding = bindGroup<ServerSettings>(
+ *                configHandler,
+ *                "server",
+ *                {{"host", &ServerSettings::host},
+ *                 {"port", &ServerSettings::port, true}},
+ *                error);
+ *
+ * @param configHandler handler with the already initialized config-file
+ * @param groupName name of the group
+ * @param fields items of the group and the members, where their values should be stored
+ * @param error reference for error-output
+ *
+ * @return binding, which is invalid, if at least one field failed at the registration
+ */
+template<typename STRUCT>
+ConfigBinding<STRUCT>
+bindGroup(ConfigHandler &configHandler,
+          const std::string &groupName,
+          const std::vector<ConfigField<STRUCT>> &fields,
+          ErrorContainer &error)
+{
+    const STRUCT defaults {};
+    std::vector<ConfigField<STRUCT>> registeredFields = fields;
+    bool valid = true;
+
+    for(ConfigField<STRUCT> &field : registeredFields)
+    {
+        const std::string &itemName = field.itemName;
+        switch(field.type)
+        {
+            case ConfigHandler::STRING_TYPE:
+                field.index = configHandler.registerString(groupName,
+                                                           itemName,
+                                                           error,
+                                                           defaults.*field.stringMember,
+                                                           field.required).index;
+                break;
+            case ConfigHandler::INT_TYPE:
+                field.index = configHandler.registerInteger(groupName,
+                                                            itemName,
+                                                            error,
+                                                            defaults.*field.intMember,
+                                                            field.required).index;
+                break;
+            case ConfigHandler::FLOAT_TYPE:
+                field.index = configHandler.registerFloat(groupName,
+                                                          itemName,
+                                                          error,
+                                                          defaults.*field.floatMember,
+                                                          field.required).index;
+                break;
+            case ConfigHandler::BOOL_TYPE:
+                field.index = configHandler.registerBoolean(groupName,
+                                                            itemName,
+                                                            error,
+                                                            defaults.*field.boolMember,
+                                                            field.required).index;
+                break;
+            case ConfigHandler::STRING_ARRAY_TYPE:
+                field.index = configHandler.registerStringArray(groupName,
+                                                                itemName,
+                                                                error,
+                                                                defaults.*field.stringArrayMember,
+                                                                field.required).index;
+                break;
+            case ConfigHandler::DURATION_TYPE:
+                field.index = configHandler.registerDuration(groupName,
+                                                             itemName,
+                                                             error,
+                                                             defaults.*field.durationMember,
+                                                             field.required).index;
+                break;
+            case ConfigHandler::BYTE_SIZE_TYPE:
+                field.index = configHandler.registerByteSize(groupName,
+                                                             itemName,
+                                                             error,
+                                                             defaults.*field.byteSizeMember,
+                                                             field.required).index;
+                break;
+            case ConfigHandler::UNDEFINED_TYPE:
+                break;
+        }
+
+        if(field.index == UNREGISTERED_CONFIG_KEY) {
+            valid = false;
+        }
+    }
+
+    return ConfigBinding<STRUCT>(&configHandler, registeredFields, valid);
+}
+
+/**
+ * @brief register all fields of a struct as items of a config-group of the global config
+ */
+template<typename STRUCT>
+ConfigBinding<STRUCT>
+bindGroup(const std::string &groupName,
+          const std::vector<ConfigField<STRUCT>> &fields,
+          ErrorContainer &error)
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return ConfigBinding<STRUCT>();
+    }
+
+    return bindGroup<STRUCT>(*ConfigHandler::m_config, groupName, fields, error);
+}
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_BINDING_H
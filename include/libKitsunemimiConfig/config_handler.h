@@ -12,168 +12,867 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <set>
+#include <atomic>
+#include <string_view>
+#include <mutex>
+#include <functional>
+#include <chrono>
+#include <stdint.h>
 #include <libKitsunemimiCommon/logger.h>
+#include <libKitsunemimiConfig/string_array_view.h>
 
 #define REGISTER_STRING_CONFIG Kitsunemimi::registerString
 #define REGISTER_INT_CONFIG Kitsunemimi::registerInteger
 #define REGISTER_FLOAT_CONFIG Kitsunemimi::registerFloat
 #define REGISTER_BOOL_CONFIG Kitsunemimi::registerBoolean
 #define REGISTER_STRING_ARRAY_CONFIG Kitsunemimi::registerStringArray
+#define REGISTER_DURATION_CONFIG Kitsunemimi::registerDuration
+#define REGISTER_BYTE_SIZE_CONFIG Kitsunemimi::registerByteSize
 
 #define GET_STRING_CONFIG Kitsunemimi::getString
+#define GET_STRING_VIEW_CONFIG Kitsunemimi::getStringView
 #define GET_INT_CONFIG Kitsunemimi::getInteger
 #define GET_FLOAT_CONFIG Kitsunemimi::getFloat
 #define GET_BOOL_CONFIG Kitsunemimi::getBoolean
 #define GET_STRING_ARRAY_CONFIG Kitsunemimi::getStringArray
+#define GET_STRING_ARRAY_VIEW_CONFIG Kitsunemimi::getStringArrayView
+#define GET_DURATION_CONFIG Kitsunemimi::getDuration
+#define GET_BYTE_SIZE_CONFIG Kitsunemimi::getByteSize
 
 namespace Kitsunemimi
 {
 class DataItem;
 class IniItem;
+class ConfigSnapshot;
+class ConfigCache;
+class ConfigAccessCounters;
+template<typename T> class ConfigRegistry;
 
 class ConfigHandler_Test;
+struct ConfigSpec;
+struct ConfigChange;
+struct ConfigConflict;
+struct ConfigAccessStats;
+struct ConfigMemoryUsage;
+struct ConfigSources;
+struct ConfigOverride;
+
+/**
+ * @brief callback for changed values, which gets all changed items of a subscription, which were
+ *        changed by the same reload
+ */
+typedef std::function<void(const std::vector<ConfigChange> &changes)> ConfigChangeCallback;
+
+#define UNREGISTERED_CONFIG_KEY 0xFFFFFFFF
+#define NUMBER_OF_READER_SHARDS 32
+
+/**
+ * @brief typed handle to a registered config-value, which is returned by the register-functions.
+ *        Reading a value with this handle is a direct access to the pre-converted value without
+ *        any lookup based on group- and item-name. A handle is only valid for the config-handler,
+ *        which has created it.
+ */
+template<typename T>
+struct ConfigKey
+{
+    uint32_t index = UNREGISTERED_CONFIG_KEY;
+
+    bool isValid() const
+    {
+        return index != UNREGISTERED_CONFIG_KEY;
+    }
+};
+
+/**
+ * @brief timings and counts of the phases of the initialization and the registration-phase of a
+ *        config. All timings are measured with a monotonic clock and summed up over all calls of
+ *        the phase. The registration-time contains the times of the type-checks, the inserts into
+ *        the registry and the formatting of the error-messages of the registration. Reloads are
+ *        not part of the profile.
+ */
+struct ConfigLoadProfile
+{
+    // initialization
+    std::chrono::nanoseconds initTime {0};
+    uint64_t numberOfSources = 0;
+    uint64_t bytesRead = 0;
+    std::chrono::nanoseconds readTime {0};
+    std::chrono::nanoseconds parseTime {0};
+    std::chrono::nanoseconds cacheTime {0};
+    bool cacheHit = false;
+
+    // registration
+    uint64_t numberOfRegistrations = 0;
+    uint64_t numberOfRegistrationErrors = 0;
+    std::chrono::nanoseconds registrationTime {0};
+    std::chrono::nanoseconds checkTypeTime {0};
+    std::chrono::nanoseconds registerTypeTime {0};
+    std::chrono::nanoseconds errorFormattingTime {0};
+
+    std::chrono::nanoseconds sealTime {0};
+};
 
 bool initConfig(const std::string &configFilePath,
-                ErrorContainer &error);
+                ErrorContainer &error,
+                const std::string &cacheFilePath = "");
+bool initConfig(const ConfigSources &sources,
+                ErrorContainer &error,
+                const std::string &cacheFilePath = "");
 bool isConfigValid();
+void sealConfig();
+void freezeConfig();
+bool reloadConfig(ErrorContainer &error);
 void resetConfig();
 
 // register config-options
-void registerString(const std::string &groupName,
-                    const std::string &itemName,
+ConfigKey<std::string> registerString(const std::string &groupName,
+                                      const std::string &itemName,
+                                      ErrorContainer &error,
+                                      const std::string &defaultValue = "",
+                                      const bool required = false);
+ConfigKey<long> registerInteger(const std::string &groupName,
+                                const std::string &itemName,
+                                ErrorContainer &error,
+                                const long defaultValue = 0,
+                                const bool required = false);
+ConfigKey<double> registerFloat(const std::string &groupName,
+                                const std::string &itemName,
+                                ErrorContainer &error,
+                                const double defaultValue = 0.0,
+                                const bool required = false);
+ConfigKey<bool> registerBoolean(const std::string &groupName,
+                                const std::string &itemName,
+                                ErrorContainer &error,
+                                const bool defaultValue = false,
+                                const bool required = false);
+ConfigKey<std::vector<std::string>> registerStringArray(
+        const std::string &groupName,
+        const std::string &itemName,
+        ErrorContainer &error,
+        const std::vector<std::string> &defaultValue = {},
+        const bool required = false);
+ConfigKey<std::chrono::nanoseconds> registerDuration(
+        const std::string &groupName,
+        const std::string &itemName,
+        ErrorContainer &error,
+        const std::chrono::nanoseconds defaultValue = std::chrono::nanoseconds(0),
+        const bool required = false);
+ConfigKey<uint64_t> registerByteSize(const std::string &groupName,
+                                     const std::string &itemName,
+                                     ErrorContainer &error,
+                                     const uint64_t defaultValue = 0,
+                                     const bool required = false);
+bool registerSchema(const std::vector<ConfigSpec> &schema,
+                    ErrorContainer &error);
+bool registerSchema(const std::vector<ConfigSpec> &schema,
                     ErrorContainer &error,
-                    const std::string &defaultValue = "",
-                    const bool required = false);
-void registerInteger(const std::string &groupName,
-                     const std::string &itemName,
-                     ErrorContainer &error,
-                     const long defaultValue = 0,
-                     const bool required = false);
-void registerFloat(const std::string &groupName,
-                   const std::string &itemName,
-                   ErrorContainer &error,
-                   const double defaultValue = 0.0,
-                   const bool required = false);
-void registerBoolean(const std::string &groupName,
-                     const std::string &itemName,
-                     ErrorContainer &error,
-                     const bool defaultValue = false,
-                     const bool required = false);
-void registerStringArray(const std::string &groupName,
-                         const std::string &itemName,
-                         ErrorContainer &error,
-                         const std::vector<std::string> &defaultValue = {},
-                         const bool required = false);
+                    std::vector<uint32_t> &indexes);
 
 // getter
-const std::string getString(const std::string &groupName,
-                            const std::string &itemName,
+const std::string getString(std::string_view groupName,
+                            std::string_view itemName,
                             bool &success);
-long getInteger(const std::string &groupName,
-                const std::string &itemName,
+long getInteger(std::string_view groupName,
+                std::string_view itemName,
                 bool &success);
-double getFloat(const std::string &groupName,
-                const std::string &itemName,
+double getFloat(std::string_view groupName,
+                std::string_view itemName,
                 bool &success);
-bool getBoolean(const std::string &groupName,
-                const std::string &itemName,
+bool getBoolean(std::string_view groupName,
+                std::string_view itemName,
                 bool &success);
-const std::vector<std::string> getStringArray(const std::string &groupName,
-                                              const std::string &itemName,
+const std::vector<std::string> getStringArray(std::string_view groupName,
+                                              std::string_view itemName,
                                               bool &success);
+std::chrono::nanoseconds getDuration(std::string_view groupName,
+                                     std::string_view itemName,
+                                     bool &success);
+uint64_t getByteSize(std::string_view groupName,
+                     std::string_view itemName,
+                     bool &success);
+
+// getter for registered handles
+const std::string getString(const ConfigKey<std::string> &key, bool &success);
+long getInteger(const ConfigKey<long> &key, bool &success);
+double getFloat(const ConfigKey<double> &key, bool &success);
+bool getBoolean(const ConfigKey<bool> &key, bool &success);
+const std::vector<std::string> getStringArray(const ConfigKey<std::vector<std::string>> &key,
+                                              bool &success);
+std::chrono::nanoseconds getDuration(const ConfigKey<std::chrono::nanoseconds> &key,
+                                     bool &success);
+uint64_t getByteSize(const ConfigKey<uint64_t> &key, bool &success);
+
+// zero-copy getter, which fail until the config is sealed, because the registration still moves
+// the stored values. The result is valid until the next reload or reset of the config.
+std::string_view getStringView(std::string_view groupName,
+                               std::string_view itemName,
+                               bool &success);
+std::string_view getStringView(const ConfigKey<std::string> &key, bool &success);
+StringArrayView getStringArrayView(std::string_view groupName,
+                                   std::string_view itemName,
+                                   bool &success);
+StringArrayView getStringArrayView(const ConfigKey<std::vector<std::string>> &key,
+                                   bool &success);
+
+// notification about changed values
+uint64_t subscribe(const std::string &groupName,
+                   const std::string &itemName,
+                   const ConfigChangeCallback &callback);
+uint64_t subscribeGroup(const std::string &groupName,
+                        const ConfigChangeCallback &callback);
+bool unsubscribe(const uint64_t subscriptionId);
 
 //==================================================================================================
 
+/**
+ * @brief Thread-safety: initConfig, the register-functions and sealConfig are not thread-safe and
+ *        have to be called by one thread at startup. After sealConfig all getter and reloadConfig
+ *        can be called by any number of threads at the same time. Getter never take a lock and
+ *        always read the values of one complete config-state, also while a reload is running.
+ *        resetConfig must not be called while other threads still use the config.
+ *
+ *        Each getter registers itself as reader of the current values, so a reload can't delete
+ *        them while they are read. This costs two atomic loads and an increment and decrement of
+ *        a counter, which is shared with other threads. A config, which is never reloaded, can be
+ *        frozen instead of sealed. Then the getter skip the registration and a handle-getter is
+ *        a single indexed load of the value.
+ *
+ *        Any number of handlers can be overlays of the same sealed base-handler. An overlay holds
+ *        only the values of its own config-file and reads everything else from the base. The
+ *        base must exist as long as its overlays.
+ */
 class ConfigHandler
 {
 public:
+    enum ConfigType
+    {
+        UNDEFINED_TYPE,
+        STRING_TYPE,
+        INT_TYPE,
+        FLOAT_TYPE,
+        BOOL_TYPE,
+        STRING_ARRAY_TYPE,
+
+        // values with a unit, which are converted at the registration and stored like integers
+        DURATION_TYPE,
+        BYTE_SIZE_TYPE
+    };
+
+    // sources of a value in ascending order of their precedence
+    enum ConfigSource
+    {
+        UNDEFINED_SOURCE,
+        DEFAULT_SOURCE,
+        FILE_SOURCE,
+        ENVIRONMENT_SOURCE,
+        COMMAND_LINE_SOURCE
+    };
+
     ConfigHandler();
     ~ConfigHandler();
 
     bool initConfig(const std::string &configFilePath,
-                    ErrorContainer &error);
+                    ErrorContainer &error,
+                    const std::string &cacheFilePath = "");
+    bool initConfig(const ConfigSources &sources,
+                    ErrorContainer &error,
+                    const std::string &cacheFilePath = "");
+    bool initOverlay(ConfigHandler &baseConfig,
+                     const std::string &configFilePath,
+                     ErrorContainer &error);
     bool isConfigValid() const;
+    void sealConfig();
+    void freezeConfig();
+    bool reloadConfig(ErrorContainer &error);
 
     // register config-options
-    void registerString(const std::string &groupName,
-                        const std::string &itemName,
+    ConfigKey<std::string> registerString(const std::string &groupName,
+                                          const std::string &itemName,
+                                          ErrorContainer &error,
+                                          const std::string &defaultValue = "",
+                                          const bool required = false);
+    ConfigKey<long> registerInteger(const std::string &groupName,
+                                    const std::string &itemName,
+                                    ErrorContainer &error,
+                                    const long defaultValue = 0,
+                                    const bool required = false);
+    ConfigKey<double> registerFloat(const std::string &groupName,
+                                    const std::string &itemName,
+                                    ErrorContainer &error,
+                                    const double defaultValue = 0.0,
+                                    const bool required = false);
+    ConfigKey<bool> registerBoolean(const std::string &groupName,
+                                    const std::string &itemName,
+                                    ErrorContainer &error,
+                                    const bool defaultValue = false,
+                                    const bool required = false);
+    ConfigKey<std::vector<std::string>> registerStringArray(
+            const std::string &groupName,
+            const std::string &itemName,
+            ErrorContainer &error,
+            const std::vector<std::string> &defaultValue = {},
+            const bool required = false);
+    ConfigKey<std::chrono::nanoseconds> registerDuration(
+            const std::string &groupName,
+            const std::string &itemName,
+            ErrorContainer &error,
+            const std::chrono::nanoseconds defaultValue = std::chrono::nanoseconds(0),
+            const bool required = false);
+    ConfigKey<uint64_t> registerByteSize(const std::string &groupName,
+                                         const std::string &itemName,
+                                         ErrorContainer &error,
+                                         const uint64_t defaultValue = 0,
+                                         const bool required = false);
+    bool registerSchema(const std::vector<ConfigSpec> &schema,
+                        ErrorContainer &error);
+    bool registerSchema(const std::vector<ConfigSpec> &schema,
                         ErrorContainer &error,
-                        const std::string &defaultValue = "",
-                        const bool required = false);
-    void registerInteger(const std::string &groupName,
-                         const std::string &itemName,
-                         ErrorContainer &error,
-                         const long defaultValue = 0,
-                         const bool required = false);
-    void registerFloat(const std::string &groupName,
-                       const std::string &itemName,
-                       ErrorContainer &error,
-                       const double defaultValue = 0.0,
-                       const bool required = false);
-    void registerBoolean(const std::string &groupName,
-                         const std::string &itemName,
-                         ErrorContainer &error,
-                         const bool defaultValue = false,
-                         const bool required = false);
-    void registerStringArray(const std::string &groupName,
-                             const std::string &itemName,
-                             ErrorContainer &error,
-                             const std::vector<std::string> &defaultValue = {},
-                             const bool required = false);
+                        std::vector<uint32_t> &indexes);
 
     // getter
-    const std::string getString(const std::string &groupName,
-                                const std::string &itemName,
+    const std::string getString(std::string_view groupName,
+                                std::string_view itemName,
                                 bool &success);
-    long getInteger(const std::string &groupName,
-                    const std::string &itemName,
+    long getInteger(std::string_view groupName,
+                    std::string_view itemName,
                     bool &success);
-    double getFloat(const std::string &groupName,
-                    const std::string &itemName,
+    double getFloat(std::string_view groupName,
+                    std::string_view itemName,
                     bool &success);
-    bool getBoolean(const std::string &groupName,
-                    const std::string &itemName,
+    bool getBoolean(std::string_view groupName,
+                    std::string_view itemName,
                     bool &success);
-    const std::vector<std::string> getStringArray(const std::string &groupName,
-                                                  const std::string &itemName,
+    const std::vector<std::string> getStringArray(std::string_view groupName,
+                                                  std::string_view itemName,
+                                                  bool &success);
+    std::chrono::nanoseconds getDuration(std::string_view groupName,
+                                         std::string_view itemName,
+                                         bool &success);
+    uint64_t getByteSize(std::string_view groupName,
+                         std::string_view itemName,
+                         bool &success);
+
+    // getter for registered handles
+    const std::string getString(const ConfigKey<std::string> &key, bool &success);
+    long getInteger(const ConfigKey<long> &key, bool &success);
+    double getFloat(const ConfigKey<double> &key, bool &success);
+    bool getBoolean(const ConfigKey<bool> &key, bool &success);
+    const std::vector<std::string> getStringArray(const ConfigKey<std::vector<std::string>> &key,
                                                   bool &success);
+    std::chrono::nanoseconds getDuration(const ConfigKey<std::chrono::nanoseconds> &key,
+                                         bool &success);
+    uint64_t getByteSize(const ConfigKey<uint64_t> &key, bool &success);
+
+    // zero-copy getter, which fail until the config is sealed, because the registration still moves
+    // the stored values. The result is valid until the next reload of the config.
+    std::string_view getStringView(std::string_view groupName,
+                                   std::string_view itemName,
+                                   bool &success);
+    std::string_view getStringView(const ConfigKey<std::string> &key, bool &success);
+    StringArrayView getStringArrayView(std::string_view groupName,
+                                       std::string_view itemName,
+                                       bool &success);
+    StringArrayView getStringArrayView(const ConfigKey<std::vector<std::string>> &key,
+                                       bool &success);
+
+    // provenance of the current values
+    ConfigSource getValueSource(const std::string &groupName,
+                                const std::string &itemName,
+                                std::string &origin);
+    const std::vector<ConfigConflict> getConflicts();
+
+    // statistics of the getter, if the library is built with instrumentation
+    const std::vector<ConfigAccessStats> getConfigAccessStats();
+
+    // timings of the initialization and registration
+    const ConfigLoadProfile getLoadProfile() const;
+
+    // heap-memory of the structures of the config
+    const ConfigMemoryUsage getMemoryUsage();
+
+    // notification about changed values
+    uint64_t subscribe(const std::string &groupName,
+                       const std::string &itemName,
+                       const ConfigChangeCallback &callback);
+    uint64_t subscribeGroup(const std::string &groupName,
+                            const ConfigChangeCallback &callback);
+    bool unsubscribe(const uint64_t subscriptionId);
+
+    /**
+     * @brief pins the current values of the config as long as the reader exists. A reload
+     *        publishes its new values nevertheless, but it waits with deleting the old ones
+     *        until the reader is destroyed, so views from the reader of a sealed config stay valid
+     *        for its whole lifetime. All values, which are read with the same reader, belong to the same
+     *        config-state. Readers should be short-lived, because they delay the end of a reload.
+     */
+    class SnapshotReader
+    {
+    public:
+        SnapshotReader(ConfigHandler* handler);
+        ~SnapshotReader();
+
+        const std::string getString(const ConfigKey<std::string> &key, bool &success) const;
+        std::string_view getStringView(const ConfigKey<std::string> &key, bool &success) const;
+        long getInteger(const ConfigKey<long> &key, bool &success) const;
+        double getFloat(const ConfigKey<double> &key, bool &success) const;
+        bool getBoolean(const ConfigKey<bool> &key, bool &success) const;
+        const std::vector<std::string> getStringArray(
+                const ConfigKey<std::vector<std::string>> &key,
+                bool &success) const;
+        StringArrayView getStringArrayView(const ConfigKey<std::vector<std::string>> &key,
+                                           bool &success) const;
+        std::chrono::nanoseconds getDuration(const ConfigKey<std::chrono::nanoseconds> &key,
+                                             bool &success) const;
+        uint64_t getByteSize(const ConfigKey<uint64_t> &key, bool &success) const;
+
+        const ConfigSnapshot* snapshot = nullptr;
+
+    private:
+        std::atomic<uint64_t>* m_readers = nullptr;
+        ConfigAccessCounters* m_accessCounters = nullptr;
+        bool m_sealed = false;
+    };
+
+    static ConfigType getStorageType(const ConfigType type);
 
     static Kitsunemimi::ConfigHandler* m_config;
 
 private:
     friend ConfigHandler_Test;
+    friend ConfigAccessCounters;
 
-    enum ConfigType
+    struct ConfigEntry
     {
-        UNDEFINED_TYPE,
-        STRING_TYPE,
-        INT_TYPE,
-        FLOAT_TYPE,
-        BOOL_TYPE,
-        STRING_ARRAY_TYPE
+        ConfigType type = UNDEFINED_TYPE;
+        uint32_t index = UNREGISTERED_CONFIG_KEY;
+        bool required = false;
+    };
+
+    struct SourceContent
+    {
+        ConfigSource source = UNDEFINED_SOURCE;
+        std::string origin = "";
+        std::string content = "";
+
+        // pattern of the include-directory, which contains the file, or empty string
+        std::string includeDirectory = "";
+        std::map<std::string, uint64_t> groupHashes;
+    };
+
+    struct ValueOrigin
+    {
+        ConfigSource source = UNDEFINED_SOURCE;
+        std::string origin = "";
+        std::string includeDirectory = "";
+
+        // other file of the same include-directory, which has set the same item before
+        std::string conflict = "";
+    };
+
+    struct ConfigFragment
+    {
+        int64_t modificationTime = 0;
+        int64_t readTime = 0;
+        uint64_t size = 0;
+        uint64_t inode = 0;
+        std::string content = "";
+        std::vector<std::pair<std::string, std::string>> includes;
+        std::map<std::string, uint64_t> groupHashes;
+    };
+    typedef std::map<std::string, std::map<std::string, ValueOrigin>> ValueOrigins;
+
+    struct Subscription
+    {
+        uint64_t id = 0;
+        std::string groupName = "";
+        std::string itemName = "";
+        bool wholeGroup = false;
+        ConfigChangeCallback callback;
+    };
+
+    struct alignas(64) ReaderCounter
+    {
+        std::atomic<uint64_t> count {0};
     };
 
     bool checkType(const std::string &groupName,
                    const std::string &itemName,
                    const ConfigType type);
-    bool isRegistered(const std::string &groupName,
-                      const std::string &itemName);
+    bool checkItemType(DataItem* currentItem,
+                       const ConfigType type);
+    static bool convertUnitValue(DataItem* currentItem,
+                                 const ConfigType type,
+                                 long &result);
+    static bool parseDuration(const std::string &input,
+                              long &result);
+    static bool parseByteSize(const std::string &input,
+                              long &result);
+    bool isRegistered(std::string_view groupName,
+                      std::string_view itemName);
     bool registerType(const std::string &groupName,
                       const std::string &itemName,
-                      const ConfigType type);
-    ConfigType getRegisteredType(const std::string &groupName,
-                                 const std::string &itemName);
+                      const ConfigType type,
+                      const bool required = false);
+    ConfigType getRegisteredType(std::string_view groupName,
+                                 std::string_view itemName);
+    const ConfigEntry* getRegisteredEntry(std::string_view groupName,
+                                          std::string_view itemName);
+
+    uint32_t getNumberOfValues(const ConfigType type) const;
+
+    uint32_t appendDefault(const ConfigSpec &spec);
+    uint32_t registerSpec(const ConfigSpec &spec,
+                          ErrorContainer &error);
 
     bool registerValue(std::string &groupName,
                        const std::string &itemName,
                        const ConfigType type,
                        const bool required,
                        ErrorContainer &error);
+    void addRegistrationError(ErrorContainer &error,
+                              const std::string &reason,
+                              const std::string &groupName,
+                              const std::string &itemName,
+                              const bool logError = true);
+    void countSources(const std::vector<SourceContent> &contents);
+    void storeValue(const std::string &groupName,
+                    const std::string &itemName,
+                    const ConfigType type,
+                    const uint32_t index);
+    ConfigSnapshot* buildOverlaySnapshot(IniItem &iniItem,
+                                         const std::string &operation,
+                                         ErrorContainer &error);
+    ConfigSnapshot* buildSnapshot(IniItem &iniItem,
+                                  const std::string &operation,
+                                  ErrorContainer &error,
+                                  const ConfigSnapshot* oldSnapshot = nullptr,
+                                  const std::set<std::string>* changedGroups = nullptr);
+    bool dropConfigCache(ErrorContainer &error);
+    void writeConfigCache();
+    void appendValue(ConfigSnapshot* snapshot,
+                     DataItem* value,
+                     const ConfigType type,
+                     const uint32_t index);
+    void copyValue(ConfigSnapshot* snapshot,
+                   const ConfigSnapshot* source,
+                   const ConfigType type,
+                   const uint32_t index);
+    void waitForReaders();
+    void collectChanges(const ConfigSnapshot* oldSnapshot,
+                        const ConfigSnapshot* newSnapshot,
+                        std::vector<ConfigChange> &changes);
+    void notifySubscribers(const std::vector<ConfigChange> &changes);
+    bool readSources(std::vector<SourceContent> &contents,
+                     ErrorContainer &error);
+    bool readIncludeDirectory(const std::string &pattern,
+                              std::vector<SourceContent> &contents,
+                              std::vector<std::string> &includeStack,
+                              std::set<std::string> &usedFragments,
+                              ErrorContainer &error);
+    void prefetchFragments(const std::vector<std::string> &filePaths,
+                           std::set<std::string> &usedFragments);
+    uint32_t getNumberOfThreads() const;
+    bool readFragment(const std::string &filePath,
+                      const std::string &includeDirectory,
+                      std::vector<SourceContent> &contents,
+                      std::vector<std::string> &includeStack,
+                      std::set<std::string> &usedFragments,
+                      ErrorContainer &error);
+    bool restoreSources(std::vector<SourceContent> &contents,
+                        ErrorContainer &error);
+    bool appendOverrides(std::vector<SourceContent> &contents,
+                         ErrorContainer &error);
+    void readEnvironment();
+    const std::string mapEnvironmentName(const std::string &groupName,
+                                         const std::string &itemName);
+    bool applyEnvironment(const std::string &groupName,
+                          const std::string &itemName,
+                          ErrorContainer &error);
+    bool parseSources(const std::vector<SourceContent> &contents,
+                      const std::set<std::string>* groupNames,
+                      IniItem &iniItem,
+                      ValueOrigins &origins,
+                      ErrorContainer &error);
+    bool loadValueOrigins();
+    static void mergeIniItem(IniItem &target,
+                             IniItem &source,
+                             const SourceContent &sourceContent,
+                             ValueOrigins &origins);
+    static void hashSources(const std::vector<SourceContent> &contents,
+                            std::map<std::string, uint64_t> &groupHashes);
+    static uint64_t hashSourceContents(const std::vector<SourceContent> &contents);
+    static const std::string extractIncludes(
+            const std::string &content,
+            std::vector<std::pair<std::string, std::string>> &includes);
+    static bool refreshFragment(const std::string &filePath,
+                                ConfigFragment &fragment,
+                                ErrorContainer &error);
+    static bool isIncludeDirectory(const std::string &path);
+    static bool listIncludeDirectory(const std::string &pattern,
+                                     std::vector<std::string> &filePaths,
+                                     ErrorContainer &error);
+    static bool createOverrideContent(const ConfigOverride &configOverride,
+                                      SourceContent &sourceContent,
+                                      ErrorContainer &error);
+    static const std::string getEnvironmentName(const std::string &prefix,
+                                                const std::string &groupName,
+                                                const std::string &itemName);
+    static bool readConfigFile(std::string &content,
+                               const std::string &filePath,
+                               ErrorContainer &error);
+    static uint32_t getReaderShard();
+    ConfigAccessCounters* getAccessCounters();
+    static void hashGroups(const std::string &content,
+                           std::map<std::string, uint64_t> &groupHashes);
+    static const std::string extractGroups(const std::string &content,
+                                           const std::set<std::string> &groupNames);
 
     std::string m_configFilePath = "";
+    ConfigSources* m_sources = nullptr;
     IniItem* m_iniItem = nullptr;
     bool m_configValid = true;
-    std::map<std::string, std::map<std::string, ConfigType>> m_registeredConfigs;
+    ConfigRegistry<ConfigEntry>* m_registeredConfigs = nullptr;
+
+    // values of the registration-phase are taken from the cache, as long as the config-file and
+    // the registrations match the cache. The content of the sources is only kept to parse it as
+    // fallback.
+    std::string m_cacheFilePath = "";
+    uint64_t m_contentHash = 0;
+    std::vector<SourceContent> m_sourceContents;
+    ConfigCache* m_configCache = nullptr;
+
+    // content of all read config-files including the included ones, which is only read again,
+    // if the modification-time, size or inode of the file has changed
+    std::map<std::string, ConfigFragment> m_fragments;
+
+    // pre-converted values of all registered items, indexed by the handles
+    std::atomic<ConfigSnapshot*> m_snapshot {nullptr};
+    ConfigSnapshot* m_defaults = nullptr;
+    bool m_sealed = false;
+
+    // a frozen config is never reloaded, so its current values are never deleted and readers
+    // don't have to be counted
+    std::atomic<bool> m_frozen {false};
+
+    // readers of the snapshot are counted separately for each epoch, so a reload only has to wait
+    // for the readers of the epoch before the swap of the snapshot
+    std::atomic<uint64_t> m_readerEpoch {0};
+    ReaderCounter m_activeReaders[2][NUMBER_OF_READER_SHARDS];
+    std::mutex m_reloadLock;
+
+    // hashes of the text of each group of the config-file of the current values, to reparse only
+    // the changed groups at a reload. Lines before the first group belong to the group ''.
+    std::map<std::string, uint64_t> m_groupHashes;
+
+    // source of each value, which is set by any source. Items, which are not in this list, have
+    // their default-value. When the values are taken from the cache, the origins are only loaded,
+    // when they are requested.
+    ValueOrigins m_valueOrigins;
+    bool m_valueOriginsLoaded = false;
+
+    // variables of the environment with the prefix of the sources, which are read only once at
+    // the initialization, and the name of the variable of each registered item, which is mapped
+    // at the registration
+    std::map<std::string, std::string> m_environment;
+    std::map<std::string, std::pair<std::string, std::string>> m_environmentNames;
+
+    // overlays share the registered items, the defaults and the values of the base-handler, which
+    // is not allowed to reload its values, as long as overlays exist
+    ConfigHandler* m_baseConfig = nullptr;
+    std::atomic<uint32_t> m_numberOfOverlays {0};
+
+    // read-counters and sampled latencies of the getter, which only exist, if the library is
+    // built with instrumentation. Overlays count their reads at their base.
+    ConfigAccessCounters* m_accessCounters = nullptr;
+
+    // timings of the initialization and registration, reloads are not measured
+    ConfigLoadProfile m_loadProfile;
+
+    // subscriptions can be added and removed by any thread at any time
+    std::vector<Subscription> m_subscriptions;
+    uint64_t m_nextSubscriptionId = 1;
+    std::mutex m_subscriptionLock;
+};
+
+//==================================================================================================
+
+/**
+ * @brief item, which has a different value after a reload. The new value can be read with the
+ *        normal getter.
+ */
+struct ConfigChange
+{
+    std::string groupName = "";
+    std::string itemName = "";
+    ConfigHandler::ConfigType type = ConfigHandler::UNDEFINED_TYPE;
+};
+
+/**
+ * @brief item, which is set by more than one config-file of the same include-directory. The value
+ *        of the file, which comes later in the order of the directory, is used.
+ */
+struct ConfigConflict
+{
+    std::string groupName = "";
+    std::string itemName = "";
+    std::string origin = "";
+    std::string overriddenOrigin = "";
+};
+
+/**
+ * @brief reads of a registered item, which are counted by all getter, if the library is built
+ *        with "CONFIG+=config_access_stats". Only every 64th getter-call of a thread measures its
+ *        latency. Bucket i of the histogram counts the sampled calls, which took between 2^i and
+ *        2^(i+1) nanoseconds.
+ */
+struct ConfigAccessStats
+{
+    std::string groupName = "";
+    std::string itemName = "";
+    ConfigHandler::ConfigType type = ConfigHandler::UNDEFINED_TYPE;
+    uint64_t numberOfReads = 0;
+    uint64_t numberOfSamples = 0;
+    std::vector<uint64_t> latencyHistogram;
+};
+
+/**
+ * @brief heap-memory of the structures of a config in bytes. The parsed config-files only exist
+ *        until the config is sealed. The registered items and the default-values of an overlay
+ *        belong to its base and are not counted for the overlay. The handler-object itself and
+ *        small parts like the subscriptions are not part of the report.
+ */
+struct ConfigMemoryUsage
+{
+    // parsed config-files of the registration-phase with all their nodes and strings
+    uint64_t parsedTree = 0;
+
+    // registered items with their names, the hash-table and the names of their
+    // environment-variables
+    uint64_t registry = 0;
+
+    // current values without the payload of their strings
+    uint64_t values = 0;
+    uint64_t stringPayloads = 0;
+
+    // default-values of all registered items including the payload of their strings
+    uint64_t defaults = 0;
+
+    // content of the config-files, which is kept to detect changes at a reload, and the source
+    // of each value, which is set by a config-file or an override
+    uint64_t sources = 0;
+    uint64_t origins = 0;
+
+    uint64_t total = 0;
+};
+
+//==================================================================================================
+
+/**
+ * @brief single value, which overrides the value of all config-files. The value is written in
+ *        the same syntax like in a config-file and converted and checked like a value of a file.
+ */
+struct ConfigOverride
+{
+    ConfigHandler::ConfigSource source = ConfigHandler::UNDEFINED_SOURCE;
+    std::string origin = "";
+    std::string groupName = "";
+    std::string itemName = "";
+    std::string value = "";
+};
+
+/**
+ * @brief all sources of a config. They are resolved once into the values of the registered items
+ *        in the order of their precedence: defaults of the registration, config-files in the
+ *        order, in which they were added, environment-overrides and command-line-overrides. At
+ *        the same precedence, later overrides win against earlier ones. If an environment-prefix
+ *        is set, each registered item can also be overridden by the environment-variable
+ *        '<PREFIX>_<GROUP>_<ITEM>', where all names are upper-case and all characters other than
+ *        letters and digits are replaced by '_'. Config-files of directories are read and parsed
+ *        by multiple threads, but merged in the same order like in a single thread.
+ */
+struct ConfigSources
+{
+    std::vector<std::string> filePaths;
+    std::vector<ConfigOverride> overrides;
+    std::string environmentPrefix = "";
+    uint32_t numberOfThreads = 1;
+
+    void addFile(const std::string &filePath);
+    void addDirectory(const std::string &directoryPath);
+    void setNumberOfThreads(const uint32_t numberOfThreads);
+    void addEnvironment(const std::string &prefix = "KITSUNEMIMI");
+    void addOverride(const ConfigHandler::ConfigSource source,
+                     const std::string &groupName,
+                     const std::string &itemName,
+                     const std::string &value,
+                     const std::string &origin = "");
+    bool addArguments(const int argc,
+                      const char* const argv[],
+                      ErrorContainer &error);
+};
+
+// provenance of the values of the global config
+ConfigHandler::ConfigSource getValueSource(const std::string &groupName,
+                                           const std::string &itemName,
+                                           std::string &origin);
+const std::vector<ConfigConflict> getConflicts();
+
+// statistics of the getter of the global config
+const std::vector<ConfigAccessStats> getConfigAccessStats();
+const ConfigLoadProfile getLoadProfile();
+const ConfigMemoryUsage getMemoryUsage();
+
+//==================================================================================================
+
+/**
+ * @brief definition of a single item for the registration of a whole schema at once. Only the
+ *        default-value, which belongs to the type of the item, is used.
+ */
+struct ConfigSpec
+{
+    std::string groupName = "";
+    std::string itemName = "";
+    ConfigHandler::ConfigType type = ConfigHandler::UNDEFINED_TYPE;
+    bool required = false;
+
+    std::string stringDefault = "";
+    long intDefault = 0;
+    double floatDefault = 0.0;
+    bool boolDefault = false;
+    std::vector<std::string> stringArrayDefault;
+    std::chrono::nanoseconds durationDefault {0};
+    uint64_t byteSizeDefault = 0;
+
+    static ConfigSpec forString(const std::string &groupName,
+                                const std::string &itemName,
+                                const std::string &defaultValue = "",
+                                const bool required = false);
+    static ConfigSpec forInteger(const std::string &groupName,
+                                 const std::string &itemName,
+                                 const long defaultValue = 0,
+                                 const bool required = false);
+    static ConfigSpec forFloat(const std::string &groupName,
+                               const std::string &itemName,
+                               const double defaultValue = 0.0,
+                               const bool required = false);
+    static ConfigSpec forBoolean(const std::string &groupName,
+                                 const std::string &itemName,
+                                 const bool defaultValue = false,
+                                 const bool required = false);
+    static ConfigSpec forStringArray(const std::string &groupName,
+                                     const std::string &itemName,
+                                     const std::vector<std::string> &defaultValue = {},
+                                     const bool required = false);
+    static ConfigSpec forDuration(
+            const std::string &groupName,
+            const std::string &itemName,
+            const std::chrono::nanoseconds defaultValue = std::chrono::nanoseconds(0),
+            const bool required = false);
+    static ConfigSpec forByteSize(const std::string &groupName,
+                                  const std::string &itemName,
+                                  const uint64_t defaultValue = 0,
+                                  const bool required = false);
 };
 
 } // namespace Kitsunemimi
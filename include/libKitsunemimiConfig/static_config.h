@@ -0,0 +1,521 @@
+/**
+ *  @file       static_config.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef STATIC_CONFIG_H
+#define STATIC_CONFIG_H
+
+#include <array>
+#include <chrono>
+#include <iterator>
+#include <string_view>
+#include <libKitsunemimiConfig/config_handler.h>
+
+#define STATIC_CONFIG_INDEX(SCHEMA, GROUP, ITEM) \
+    Kitsunemimi::findStaticConfigEntry(SCHEMA::entries, GROUP, ITEM)
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief single entry of a schema, which is known at compile-time
+ */
+struct StaticConfigEntry
+{
+    std::string_view groupName;
+    std::string_view itemName;
+    ConfigHandler::ConfigType type = ConfigHandler::UNDEFINED_TYPE;
+    std::string_view stringDefault = "";
+    long intDefault = 0;
+    double floatDefault = 0.0;
+    bool boolDefault = false;
+    std::chrono::nanoseconds durationDefault {0};
+    uint64_t byteSizeDefault = 0;
+    bool required = false;
+};
+
+//==================================================================================================
+
+constexpr StaticConfigEntry
+staticString(const std::string_view groupName,
+             const std::string_view itemName,
+             const std::string_view defaultValue = "",
+             const bool required = false)
+{
+    StaticConfigEntry entry;
+    entry.groupName = groupName;
+    entry.itemName = itemName;
+    entry.type = ConfigHandler::STRING_TYPE;
+    entry.stringDefault = defaultValue;
+    entry.required = required;
+    return entry;
+}
+
+constexpr StaticConfigEntry
+staticInteger(const std::string_view groupName,
+              const std::string_view itemName,
+              const long defaultValue = 0,
+              const bool required = false)
+{
+    StaticConfigEntry entry;
+    entry.groupName = groupName;
+    entry.itemName = itemName;
+    entry.type = ConfigHandler::INT_TYPE;
+    entry.intDefault = defaultValue;
+    entry.required = required;
+    return entry;
+}
+
+constexpr StaticConfigEntry
+staticFloat(const std::string_view groupName,
+            const std::string_view itemName,
+            const double defaultValue = 0.0,
+            const bool required = false)
+{
+    StaticConfigEntry entry;
+    entry.groupName = groupName;
+    entry.itemName = itemName;
+    entry.type = ConfigHandler::FLOAT_TYPE;
+    entry.floatDefault = defaultValue;
+    entry.required = required;
+    return entry;
+}
+
+constexpr StaticConfigEntry
+staticBoolean(const std::string_view groupName,
+              const std::string_view itemName,
+              const bool defaultValue = false,
+              const bool required = false)
+{
+    StaticConfigEntry entry;
+    entry.groupName = groupName;
+    entry.itemName = itemName;
+    entry.type = ConfigHandler::BOOL_TYPE;
+    entry.boolDefault = defaultValue;
+    entry.required = required;
+    return entry;
+}
+
+/**
+ * @brief string-arrays can not be constructed at compile-time, so the default is always empty
+ */
+constexpr StaticConfigEntry
+staticStringArray(const std::string_view groupName,
+                  const std::string_view itemName,
+                  const bool required = false)
+{
+    StaticConfigEntry entry;
+    entry.groupName = groupName;
+    entry.itemName = itemName;
+    entry.type = ConfigHandler::STRING_ARRAY_TYPE;
+    entry.required = required;
+    return entry;
+}
+
+constexpr StaticConfigEntry
+staticDuration(const std::string_view groupName,
+               const std::string_view itemName,
+               const std::chrono::nanoseconds defaultValue = std::chrono::nanoseconds(0),
+               const bool required = false)
+{
+    StaticConfigEntry entry;
+    entry.groupName = groupName;
+    entry.itemName = itemName;
+    entry.type = ConfigHandler::DURATION_TYPE;
+    entry.durationDefault = defaultValue;
+    entry.required = required;
+    return entry;
+}
+
+constexpr StaticConfigEntry
+staticByteSize(const std::string_view groupName,
+               const std::string_view itemName,
+               const uint64_t defaultValue = 0,
+               const bool required = false)
+{
+    StaticConfigEntry entry;
+    entry.groupName = groupName;
+    entry.itemName = itemName;
+    entry.type = ConfigHandler::BYTE_SIZE_TYPE;
+    entry.byteSizeDefault = defaultValue;
+    entry.required = required;
+    return entry;
+}
+
+//==================================================================================================
+
+/**
+ * @brief empty group-names are registered within the default-group
+ */
+constexpr std::string_view
+staticGroupName(const std::string_view groupName)
+{
+    if(groupName.size() == 0) {
+        return "DEFAULT";
+    }
+
+    return groupName;
+}
+
+/**
+ * @brief get position of an entry within the schema at compile-time
+ *
+ * @return position of the entry, or the size of the schema, if not found
+ */
+template<uint32_t N>
+constexpr uint32_t
+findStaticConfigEntry(const StaticConfigEntry (&entries)[N],
+                      const std::string_view groupName,
+                      const std::string_view itemName)
+{
+    for(uint32_t i = 0; i < N; i++)
+    {
+        if(staticGroupName(entries[i].groupName) == staticGroupName(groupName)
+                && entries[i].itemName == itemName)
+        {
+            return i;
+        }
+    }
+
+    return N;
+}
+
+/**
+ * @brief check at compile-time, that no group- and item-name is used twice within the schema
+ */
+template<uint32_t N>
+constexpr bool
+hasUniqueStaticConfigEntries(const StaticConfigEntry (&entries)[N])
+{
+    for(uint32_t i = 0; i < N; i++)
+    {
+        if(findStaticConfigEntry(entries, entries[i].groupName, entries[i].itemName) != i) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief count entries of a specific type before a position within the schema, which is the
+ *        position of the value of the entry within the value-array of its type
+ */
+template<uint32_t N>
+constexpr uint32_t
+countStaticConfigEntries(const StaticConfigEntry (&entries)[N],
+                         const ConfigHandler::ConfigType type,
+                         const uint32_t end = N)
+{
+    uint32_t counter = 0;
+    for(uint32_t i = 0; i < end; i++)
+    {
+        if(entries[i].type == type) {
+            counter++;
+        }
+    }
+
+    return counter;
+}
+
+//==================================================================================================
+
+/**
+ * @brief config with a schema, which is completely known at compile-time. The schema is a type,
+ *        which provides a static constexpr array of entries:
+ *
+ *        struct ExampleSchema
+ *        {
+ *            static constexpr StaticConfigEntry entries[] = {
+ *                staticInteger("DEFAULT", "int_val", 42),
+ *                staticString("DEFAULT", "string_val", "default"),
+ *            };
+ *        };
+ *
+ *        Positions of the entries and their values are resolved at compile-time, so reading a
+ *        value is a load from a fixed offset. Using a group- and item-name twice within the
+ *        schema or reading an item with the wrong type results in a compile-error.
+ *
+ *        The values are copies, which are taken at the initialization. They are not changed by a
+ *        reload of the config-handler, until updateConfig is called.
+ */
+template<typename SCHEMA>
+class StaticConfig
+{
+public:
+    static constexpr uint32_t numberOfEntries = std::size(SCHEMA::entries);
+
+    static_assert(hasUniqueStaticConfigEntries(SCHEMA::entries),
+                  "item is registered more than once within the static config-schema");
+    static_assert(countStaticConfigEntries(SCHEMA::entries, ConfigHandler::UNDEFINED_TYPE) == 0,
+                  "item of the static config-schema has no type");
+
+    StaticConfig() {}
+
+    /**
+     * @brief register all entries of the schema within a config-handler in one pass and take
+     *        over the validated values
+     *
+     * @param configHandler handler with the already initialized config-file
+     * @param error reference for error-output
+     *
+     * @return false, if at least one entry failed the validation, else true
+     */
+    bool
+    initConfig(ConfigHandler &configHandler,
+               ErrorContainer &error)
+    {
+        bool result = true;
+
+        for(uint32_t i = 0; i < numberOfEntries; i++)
+        {
+            const StaticConfigEntry &entry = SCHEMA::entries[i];
+            const std::string groupName(entry.groupName);
+            const std::string itemName(entry.itemName);
+            m_indexes[i] = UNREGISTERED_CONFIG_KEY;
+
+            switch(entry.type)
+            {
+                case ConfigHandler::STRING_TYPE:
+                    m_indexes[i] = configHandler.registerString(groupName,
+                                                                itemName,
+                                                                error,
+                                                                std::string(entry.stringDefault),
+                                                                entry.required).index;
+                    break;
+                case ConfigHandler::INT_TYPE:
+                    m_indexes[i] = configHandler.registerInteger(groupName,
+                                                                 itemName,
+                                                                 error,
+                                                                 entry.intDefault,
+                                                                 entry.required).index;
+                    break;
+                case ConfigHandler::FLOAT_TYPE:
+                    m_indexes[i] = configHandler.registerFloat(groupName,
+                                                               itemName,
+                                                               error,
+                                                               entry.floatDefault,
+                                                               entry.required).index;
+                    break;
+                case ConfigHandler::BOOL_TYPE:
+                    m_indexes[i] = configHandler.registerBoolean(groupName,
+                                                                 itemName,
+                                                                 error,
+                                                                 entry.boolDefault,
+                                                                 entry.required).index;
+                    break;
+                case ConfigHandler::STRING_ARRAY_TYPE:
+                    m_indexes[i] = configHandler.registerStringArray(groupName,
+                                                                     itemName,
+                                                                     error,
+                                                                     {},
+                                                                     entry.required).index;
+                    break;
+                case ConfigHandler::DURATION_TYPE:
+                    m_indexes[i] = configHandler.registerDuration(groupName,
+                                                                  itemName,
+                                                                  error,
+                                                                  entry.durationDefault,
+                                                                  entry.required).index;
+                    break;
+                case ConfigHandler::BYTE_SIZE_TYPE:
+                    m_indexes[i] = configHandler.registerByteSize(groupName,
+                                                                  itemName,
+                                                                  error,
+                                                                  entry.byteSizeDefault,
+                                                                  entry.required).index;
+                    break;
+                case ConfigHandler::UNDEFINED_TYPE:
+                    break;
+            }
+
+            if(m_indexes[i] == UNREGISTERED_CONFIG_KEY) {
+                result = false;
+            }
+        }
+
+        return updateConfig(configHandler) && result;
+    }
+
+    /**
+     * @brief take over the current values of the config-handler again. The getter of the static
+     *        config only return the copies of the last call of initConfig or updateConfig, so
+     *        after a reload of the config-handler this has to be called to see the new values,
+     *        for example within a subscription-callback, which is called after the new values
+     *        are published. It must not run at the same time like the getter of this object.
+     *
+     * @param configHandler handler, where the schema was registered by initConfig
+     *
+     * @return false, if at least one entry is not registered, else true
+     */
+    bool
+    updateConfig(ConfigHandler &configHandler)
+    {
+        bool result = true;
+        bool success = false;
+        uint32_t stringPos = 0;
+        uint32_t intPos = 0;
+        uint32_t floatPos = 0;
+        uint32_t boolPos = 0;
+        uint32_t stringArrayPos = 0;
+        uint32_t durationPos = 0;
+        uint32_t byteSizePos = 0;
+
+        for(uint32_t i = 0; i < numberOfEntries; i++)
+        {
+            const uint32_t index = m_indexes[i];
+
+            switch(SCHEMA::entries[i].type)
+            {
+                case ConfigHandler::STRING_TYPE:
+                    m_stringValues[stringPos++] =
+                            configHandler.getString(ConfigKey<std::string>{index}, success);
+                    break;
+                case ConfigHandler::INT_TYPE:
+                    m_intValues[intPos++] =
+                            configHandler.getInteger(ConfigKey<long>{index}, success);
+                    break;
+                case ConfigHandler::FLOAT_TYPE:
+                    m_floatValues[floatPos++] =
+                            configHandler.getFloat(ConfigKey<double>{index}, success);
+                    break;
+                case ConfigHandler::BOOL_TYPE:
+                    m_boolValues[boolPos++] =
+                            configHandler.getBoolean(ConfigKey<bool>{index}, success);
+                    break;
+                case ConfigHandler::STRING_ARRAY_TYPE:
+                    m_stringArrayValues[stringArrayPos++] =
+                            configHandler.getStringArray(ConfigKey<std::vector<std::string>>{index},
+                                                         success);
+                    break;
+                case ConfigHandler::DURATION_TYPE:
+                    m_durationValues[durationPos++] =
+                            configHandler.getDuration(ConfigKey<std::chrono::nanoseconds>{index},
+                                                      success);
+                    break;
+                case ConfigHandler::BYTE_SIZE_TYPE:
+                    m_byteSizeValues[byteSizePos++] =
+                            configHandler.getByteSize(ConfigKey<uint64_t>{index}, success);
+                    break;
+                case ConfigHandler::UNDEFINED_TYPE:
+                    success = false;
+                    break;
+            }
+
+            if(success == false) {
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    template<uint32_t INDEX>
+    const std::string&
+    getString() const
+    {
+        static_assert(INDEX < numberOfEntries, "item is not part of the static config-schema");
+        static_assert(SCHEMA::entries[INDEX].type == ConfigHandler::STRING_TYPE,
+                      "item is not registered as string");
+        return m_stringValues[typedIndex<INDEX>()];
+    }
+
+    template<uint32_t INDEX>
+    long
+    getInteger() const
+    {
+        static_assert(INDEX < numberOfEntries, "item is not part of the static config-schema");
+        static_assert(SCHEMA::entries[INDEX].type == ConfigHandler::INT_TYPE,
+                      "item is not registered as integer");
+        return m_intValues[typedIndex<INDEX>()];
+    }
+
+    template<uint32_t INDEX>
+    double
+    getFloat() const
+    {
+        static_assert(INDEX < numberOfEntries, "item is not part of the static config-schema");
+        static_assert(SCHEMA::entries[INDEX].type == ConfigHandler::FLOAT_TYPE,
+                      "item is not registered as float");
+        return m_floatValues[typedIndex<INDEX>()];
+    }
+
+    template<uint32_t INDEX>
+    bool
+    getBoolean() const
+    {
+        static_assert(INDEX < numberOfEntries, "item is not part of the static config-schema");
+        static_assert(SCHEMA::entries[INDEX].type == ConfigHandler::BOOL_TYPE,
+                      "item is not registered as boolean");
+        return m_boolValues[typedIndex<INDEX>()];
+    }
+
+    template<uint32_t INDEX>
+    const std::vector<std::string>&
+    getStringArray() const
+    {
+        static_assert(INDEX < numberOfEntries, "item is not part of the static config-schema");
+        static_assert(SCHEMA::entries[INDEX].type == ConfigHandler::STRING_ARRAY_TYPE,
+                      "item is not registered as string-array");
+        return m_stringArrayValues[typedIndex<INDEX>()];
+    }
+
+    template<uint32_t INDEX>
+    std::chrono::nanoseconds
+    getDuration() const
+    {
+        static_assert(INDEX < numberOfEntries, "item is not part of the static config-schema");
+        static_assert(SCHEMA::entries[INDEX].type == ConfigHandler::DURATION_TYPE,
+                      "item is not registered as duration");
+        return m_durationValues[typedIndex<INDEX>()];
+    }
+
+    template<uint32_t INDEX>
+    uint64_t
+    getByteSize() const
+    {
+        static_assert(INDEX < numberOfEntries, "item is not part of the static config-schema");
+        static_assert(SCHEMA::entries[INDEX].type == ConfigHandler::BYTE_SIZE_TYPE,
+                      "item is not registered as byte-size");
+        return m_byteSizeValues[typedIndex<INDEX>()];
+    }
+
+private:
+    template<uint32_t INDEX>
+    static constexpr uint32_t
+    typedIndex()
+    {
+        return countStaticConfigEntries(SCHEMA::entries, SCHEMA::entries[INDEX].type, INDEX);
+    }
+
+    std::array<uint32_t, numberOfEntries> m_indexes {};
+    std::array<std::string,
+               countStaticConfigEntries(SCHEMA::entries, ConfigHandler::STRING_TYPE)>
+        m_stringValues;
+    std::array<long,
+               countStaticConfigEntries(SCHEMA::entries, ConfigHandler::INT_TYPE)>
+        m_intValues {};
+    std::array<double,
+               countStaticConfigEntries(SCHEMA::entries, ConfigHandler::FLOAT_TYPE)>
+        m_floatValues {};
+    std::array<bool,
+               countStaticConfigEntries(SCHEMA::entries, ConfigHandler::BOOL_TYPE)>
+        m_boolValues {};
+    std::array<std::vector<std::string>,
+               countStaticConfigEntries(SCHEMA::entries, ConfigHandler::STRING_ARRAY_TYPE)>
+        m_stringArrayValues;
+    std::array<std::chrono::nanoseconds,
+               countStaticConfigEntries(SCHEMA::entries, ConfigHandler::DURATION_TYPE)>
+        m_durationValues {};
+    std::array<uint64_t,
+               countStaticConfigEntries(SCHEMA::entries, ConfigHandler::BYTE_SIZE_TYPE)>
+        m_byteSizeValues {};
+};
+
+} // namespace Kitsunemimi
+
+#endif // STATIC_CONFIG_H
@@ -0,0 +1,126 @@
+/**
+ *  @file       string_array_view.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef STRING_ARRAY_VIEW_H
+#define STRING_ARRAY_VIEW_H
+
+#include <string_view>
+#include <iterator>
+#include <stdint.h>
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief position of a string within the string-buffer of the config
+ */
+struct ConfigStringRef
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+};
+
+/**
+ * @brief read-only view on a string-array of the config, which doesn't copy or allocate anything.
+ *        Each element is returned as view into the string-buffer of the config.
+ */
+class StringArrayView
+{
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = std::string_view;
+
+        const_iterator(const char* buffer,
+                       const ConfigStringRef* element)
+            : m_buffer(buffer),
+              m_element(element) {}
+
+        std::string_view
+        operator*() const
+        {
+            return std::string_view(m_buffer + m_element->offset, m_element->size);
+        }
+
+        const_iterator&
+        operator++()
+        {
+            m_element++;
+            return *this;
+        }
+
+        bool
+        operator==(const const_iterator &other) const
+        {
+            return m_element == other.m_element;
+        }
+
+        bool
+        operator!=(const const_iterator &other) const
+        {
+            return m_element != other.m_element;
+        }
+
+    private:
+        const char* m_buffer = nullptr;
+        const ConfigStringRef* m_element = nullptr;
+    };
+
+    StringArrayView() {}
+
+    StringArrayView(const char* buffer,
+                    const ConfigStringRef* elements,
+                    const uint32_t size)
+        : m_buffer(buffer),
+          m_elements(elements),
+          m_size(size) {}
+
+    uint32_t
+    size() const
+    {
+        return m_size;
+    }
+
+    bool
+    empty() const
+    {
+        return m_size == 0;
+    }
+
+    std::string_view
+    operator[](const uint32_t pos) const
+    {
+        return std::string_view(m_buffer + m_elements[pos].offset, m_elements[pos].size);
+    }
+
+    const_iterator
+    begin() const
+    {
+        return const_iterator(m_buffer, m_elements);
+    }
+
+    const_iterator
+    end() const
+    {
+        return const_iterator(m_buffer, m_elements + m_size);
+    }
+
+private:
+    const char* m_buffer = nullptr;
+    const ConfigStringRef* m_elements = nullptr;
+    uint32_t m_size = 0;
+};
+
+} // namespace Kitsunemimi
+
+#endif // STRING_ARRAY_VIEW_H
@@ -0,0 +1,99 @@
+/**
+ *  @file       config_access_stats.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include <config_access_stats.h>
+
+namespace Kitsunemimi
+{
+
+thread_local ConfigAccessRecorder::ThreadState ConfigAccessRecorder::m_thread;
+
+/**
+ * @brief constructor
+ */
+ConfigAccessCounters::ConfigAccessCounters() {}
+
+/**
+ * @brief destructor
+ */
+ConfigAccessCounters::~ConfigAccessCounters() {}
+
+/**
+ * @brief add counters for a new registered item, whose value is appended to the value-list of
+ *        its type
+ *
+ * @param type type of the new item
+ */
+void
+ConfigAccessCounters::addKey(const ConfigHandler::ConfigType type)
+{
+    const ConfigHandler::ConfigType storageType = ConfigHandler::getStorageType(type);
+    if(storageType == ConfigHandler::UNDEFINED_TYPE) {
+        return;
+    }
+
+    for(uint32_t shard = 0; shard < NUMBER_OF_READER_SHARDS; shard++) {
+        m_reads[shard][storageType].emplace_back(0);
+    }
+    m_latencies[storageType].emplace_back();
+}
+
+/**
+ * @brief get the number of reads of an item over all shards
+ *
+ * @param type type of the item
+ * @param index index of the value of the item
+ *
+ * @return number of reads
+ */
+uint64_t
+ConfigAccessCounters::getNumberOfReads(const ConfigHandler::ConfigType type,
+                                       const uint32_t index) const
+{
+    const ConfigHandler::ConfigType storageType = ConfigHandler::getStorageType(type);
+    uint64_t result = 0;
+
+    for(uint32_t shard = 0; shard < NUMBER_OF_READER_SHARDS; shard++)
+    {
+        const std::deque<std::atomic<uint64_t>> &reads = m_reads[shard][storageType];
+        if(index < reads.size()) {
+            result += reads[index].load(std::memory_order_relaxed);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief get the histogram of the sampled latencies of an item
+ *
+ * @param type type of the item
+ * @param index index of the value of the item
+ *
+ * @return number of samples per bucket, or empty list, if the item doesn't exist
+ */
+const std::vector<uint64_t>
+ConfigAccessCounters::getLatencyHistogram(const ConfigHandler::ConfigType type,
+                                          const uint32_t index) const
+{
+    const ConfigHandler::ConfigType storageType = ConfigHandler::getStorageType(type);
+    std::vector<uint64_t> result;
+    if(index >= m_latencies[storageType].size()) {
+        return result;
+    }
+
+    const LatencyHistogram &histogram = m_latencies[storageType][index];
+    result.reserve(CONFIG_LATENCY_BUCKETS);
+    for(uint32_t i = 0; i < CONFIG_LATENCY_BUCKETS; i++) {
+        result.push_back(histogram.buckets[i].load(std::memory_order_relaxed));
+    }
+
+    return result;
+}
+
+} // namespace Kitsunemimi
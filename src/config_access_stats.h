@@ -0,0 +1,198 @@
+/**
+ *  @file       config_access_stats.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_ACCESS_STATS_H
+#define CONFIG_ACCESS_STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <vector>
+#include <stdint.h>
+
+#include <libKitsunemimiConfig/config_handler.h>
+
+// only every n-th getter-call of a thread measures its latency
+#define CONFIG_ACCESS_SAMPLE_RATE 64
+
+// bucket i of the histograms counts latencies between 2^i and 2^(i+1) nanoseconds
+#define CONFIG_LATENCY_BUCKETS 32
+
+// the getter are only instrumented, if the library is built with "CONFIG+=config_access_stats"
+#ifdef KITSUNEMIMI_CONFIG_ACCESS_STATS
+#define RECORD_CONFIG_ACCESS(COUNTERS) ConfigAccessRecorder accessRecorder(COUNTERS)
+#define SET_CONFIG_ACCESS_KEY(TYPE, INDEX) accessRecorder.setKey(TYPE, INDEX)
+#else
+#define RECORD_CONFIG_ACCESS(COUNTERS)
+#define SET_CONFIG_ACCESS_KEY(TYPE, INDEX)
+#endif
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief read-counters and sampled latencies of the getter for each registered item. The items
+ *        are identified like their values by the value-list of their type and their index. The
+ *        read-counters are sharded like the reader-counters of the handler, so threads in
+ *        different shards never write into the same array. New items can only be added by the
+ *        registration, which is never running at the same time like a getter.
+ */
+class ConfigAccessCounters
+{
+public:
+    ConfigAccessCounters();
+    ~ConfigAccessCounters();
+
+    void addKey(const ConfigHandler::ConfigType type);
+
+    /**
+     * @brief get the reader-shard of the current thread
+     */
+    static uint32_t
+    getReaderShard()
+    {
+        return ConfigHandler::getReaderShard();
+    }
+
+    /**
+     * @brief count a single read of an item
+     *
+     * @param type type of the item
+     * @param index index of the value of the item
+     * @param shard shard of the current thread
+     */
+    inline void
+    countRead(const ConfigHandler::ConfigType type,
+              const uint32_t index,
+              const uint32_t shard)
+    {
+        const ConfigHandler::ConfigType storageType = ConfigHandler::getStorageType(type);
+        std::deque<std::atomic<uint64_t>> &reads = m_reads[shard][storageType];
+        if(index < reads.size()) {
+            reads[index].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief add a measured latency of a getter to the histogram of an item
+     *
+     * @param type type of the item
+     * @param index index of the value of the item
+     * @param latency duration of the getter-call
+     */
+    inline void
+    addSample(const ConfigHandler::ConfigType type,
+              const uint32_t index,
+              const std::chrono::nanoseconds latency)
+    {
+        const ConfigHandler::ConfigType storageType = ConfigHandler::getStorageType(type);
+        if(index >= m_latencies[storageType].size()) {
+            return;
+        }
+
+        const uint64_t nanoseconds = static_cast<uint64_t>(latency.count()) | 1;
+        uint32_t bucket = 63 - __builtin_clzll(nanoseconds);
+        if(bucket >= CONFIG_LATENCY_BUCKETS) {
+            bucket = CONFIG_LATENCY_BUCKETS - 1;
+        }
+
+        m_latencies[storageType][index].buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t getNumberOfReads(const ConfigHandler::ConfigType type,
+                              const uint32_t index) const;
+    const std::vector<uint64_t> getLatencyHistogram(const ConfigHandler::ConfigType type,
+                                                    const uint32_t index) const;
+
+private:
+    struct LatencyHistogram
+    {
+        std::atomic<uint64_t> buckets[CONFIG_LATENCY_BUCKETS] = {};
+    };
+
+    // read-counters per shard and value-list, indexed like the values
+    std::deque<std::atomic<uint64_t>> m_reads[NUMBER_OF_READER_SHARDS]
+                                             [ConfigHandler::STRING_ARRAY_TYPE + 1];
+    std::deque<LatencyHistogram> m_latencies[ConfigHandler::STRING_ARRAY_TYPE + 1];
+};
+
+//==================================================================================================
+
+/**
+ * @brief measures a single call of a getter. It is created at the beginning of the getter and the
+ *        read is counted, as soon as the getter has found its item. If the call is sampled, the
+ *        latency is added, when the recorder is destroyed at the end of the getter.
+ */
+class ConfigAccessRecorder
+{
+public:
+    ConfigAccessRecorder(ConfigAccessCounters* counters)
+        : m_counters(counters)
+    {
+        m_thread.numberOfCalls++;
+        if(m_counters != nullptr
+                && m_thread.numberOfCalls % CONFIG_ACCESS_SAMPLE_RATE == 0)
+        {
+            m_sampled = true;
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ConfigAccessRecorder()
+    {
+        if(m_sampled
+                && m_index != UNREGISTERED_CONFIG_KEY)
+        {
+            const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            m_counters->addSample(m_type, m_index, end - m_start);
+        }
+    }
+
+    /**
+     * @brief set the item, which is read by the getter, and count the read
+     *
+     * @param type type of the item
+     * @param index index of the value of the item
+     */
+    inline void
+    setKey(const ConfigHandler::ConfigType type,
+           const uint32_t index)
+    {
+        if(m_counters == nullptr) {
+            return;
+        }
+
+        // the shard is assigned at the first read of the thread, because a thread-local with
+        // constant initialization is much cheaper to access than one with a dynamic one
+        if(m_thread.shard == NUMBER_OF_READER_SHARDS) {
+            m_thread.shard = ConfigAccessCounters::getReaderShard();
+        }
+
+        m_type = type;
+        m_index = index;
+        m_counters->countRead(type, index, m_thread.shard);
+    }
+
+private:
+    struct ThreadState
+    {
+        uint32_t numberOfCalls = 0;
+        uint32_t shard = NUMBER_OF_READER_SHARDS;
+    };
+    static thread_local ThreadState m_thread;
+
+    ConfigAccessCounters* m_counters = nullptr;
+    ConfigHandler::ConfigType m_type = ConfigHandler::UNDEFINED_TYPE;
+    uint32_t m_index = UNREGISTERED_CONFIG_KEY;
+    bool m_sampled = false;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_ACCESS_STATS_H
@@ -0,0 +1,361 @@
+/**
+ *  @file       config_cache.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include <config_cache.h>
+
+#include <fstream>
+#include <cstdio>
+#include <unistd.h>
+
+namespace Kitsunemimi
+{
+
+const char CONFIG_CACHE_MAGIC[8] = {'K', 'M', 'C', 'F', 'G', 'C', 'C', 'H'};
+
+/**
+ * @brief append a string together with its size to a binary buffer
+ */
+static void
+appendString(std::string &output, const std::string &value)
+{
+    appendBinary(output, static_cast<uint32_t>(value.size()));
+    output.append(value);
+}
+
+/**
+ * @brief read a string, which was written by appendString
+ */
+static bool
+readString(const std::string &input, uint64_t &position, std::string &value)
+{
+    uint32_t size = 0;
+    if(readBinary(input, position, size) == false
+            || input.size() - position < size)
+    {
+        return false;
+    }
+
+    value.assign(input.data() + position, size);
+    position += size;
+    return true;
+}
+
+/**
+ * @brief constructor
+ */
+ConfigCache::ConfigCache()
+{
+    m_entries.resize(ConfigHandler::STRING_ARRAY_TYPE + 1);
+}
+
+/**
+ * @brief destructor
+ */
+ConfigCache::~ConfigCache() {}
+
+/**
+ * @brief restore cache from the content of a cache-file
+ *
+ * @param input content of the cache-file
+ * @param contentHash hash of the current config-file
+ *
+ * @return false, if the cache is broken, has another format or belongs to another version of
+ *         the config-file, else true
+ */
+bool
+ConfigCache::parseCache(const std::string &input,
+                        const uint64_t contentHash)
+{
+    uint64_t position = 0;
+
+    // check header
+    char magic[8];
+    uint32_t version = 0;
+    uint32_t sizeOfLong = 0;
+    uint64_t cachedContentHash = 0;
+    if(readBinary(input, position, magic) == false
+            || memcmp(magic, CONFIG_CACHE_MAGIC, sizeof(magic)) != 0
+            || readBinary(input, position, version) == false
+            || version != CONFIG_CACHE_VERSION
+            || readBinary(input, position, sizeOfLong) == false
+            || sizeOfLong != sizeof(long)
+            || readBinary(input, position, cachedContentHash) == false
+            || cachedContentHash != contentHash
+            || readBinary(input, position, schemaHash) == false)
+    {
+        return false;
+    }
+
+    // read registered items
+    for(uint32_t type = ConfigHandler::STRING_TYPE; type < m_entries.size(); type++)
+    {
+        uint32_t numberOfEntries = 0;
+        if(readBinary(input, position, numberOfEntries) == false) {
+            return false;
+        }
+
+        for(uint32_t i = 0; i < numberOfEntries; i++)
+        {
+            CacheEntry entry;
+            uint8_t flags = 0;
+            uint8_t entryType = 0;
+            if(readBinary(input, position, flags) == false
+                    || readBinary(input, position, entryType) == false
+                    || readString(input, position, entry.groupName) == false
+                    || readString(input, position, entry.itemName) == false)
+            {
+                return false;
+            }
+
+            // the registered type must be stored in the value-list of this type
+            entry.type = static_cast<ConfigHandler::ConfigType>(entryType);
+            if(entryType > ConfigHandler::BYTE_SIZE_TYPE
+                    || ConfigHandler::getStorageType(entry.type) != type)
+            {
+                return false;
+            }
+
+            entry.required = flags & 1;
+            entry.inFile = flags & 2;
+            m_entries[type].push_back(entry);
+        }
+    }
+
+    // read values
+    if(m_values.deserialize(input, position) == false
+            || position != input.size())
+    {
+        return false;
+    }
+
+    // each registered item must have a value
+    const uint32_t numberOfStringArrays = m_entries[ConfigHandler::STRING_ARRAY_TYPE].size();
+    if(m_values.numberOfStrings() != m_entries[ConfigHandler::STRING_TYPE].size()
+            || m_values.numberOfIntegers() != m_entries[ConfigHandler::INT_TYPE].size()
+            || m_values.numberOfFloats() != m_entries[ConfigHandler::FLOAT_TYPE].size()
+            || m_values.numberOfBooleans() != m_entries[ConfigHandler::BOOL_TYPE].size()
+            || m_values.numberOfStringArrays() != numberOfStringArrays)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief check if a new registration is the same like the registration at the same position at
+ *        the time, when the cache was written
+ *
+ * @param groupName group-name of the new item
+ * @param itemName item-name of the new item
+ * @param type type of the new item
+ * @param required true, if the new item is required
+ * @param index index, which the value of the new item will get
+ *
+ * @return true, if the value of the new item can be taken from the cache, else false
+ */
+bool
+ConfigCache::matches(const std::string &groupName,
+                     const std::string &itemName,
+                     const ConfigHandler::ConfigType type,
+                     const bool required,
+                     const uint32_t index) const
+{
+    const ConfigHandler::ConfigType storageType = ConfigHandler::getStorageType(type);
+    if(type == ConfigHandler::UNDEFINED_TYPE
+            || index >= m_entries[storageType].size())
+    {
+        return false;
+    }
+
+    const CacheEntry &entry = m_entries[storageType][index];
+    return entry.groupName == groupName
+           && entry.itemName == itemName
+           && entry.type == type
+           && entry.required == required;
+}
+
+/**
+ * @brief check if the value of a cached item was set in the config-file
+ *
+ * @param type type of the item
+ * @param index index of the value of the item
+ *
+ * @return true, if the value came from the config-file, false if it came from the defaults
+ */
+bool
+ConfigCache::isInFile(const ConfigHandler::ConfigType type,
+                      const uint32_t index) const
+{
+    return m_entries[ConfigHandler::getStorageType(type)][index].inFile;
+}
+
+/**
+ * @brief append the cached value of an item to a snapshot. If the item was not set in the
+ *        config-file, the value comes from the defaults, because the default-value may have
+ *        changed since the cache was written.
+ *
+ * @param snapshot snapshot, where the value should be appended
+ * @param defaults default-values of the registered items
+ * @param type type of the item
+ * @param index index of the value of the item
+ */
+void
+ConfigCache::appendValue(ConfigSnapshot* snapshot,
+                         const ConfigSnapshot* defaults,
+                         const ConfigHandler::ConfigType type,
+                         const uint32_t index) const
+{
+    const ConfigSnapshot* source = &m_values;
+    if(isInFile(type, index) == false) {
+        source = defaults;
+    }
+
+    switch(ConfigHandler::getStorageType(type))
+    {
+        case ConfigHandler::STRING_TYPE:
+            snapshot->appendString(source->getString(index));
+            break;
+        case ConfigHandler::INT_TYPE:
+            snapshot->appendInteger(source->getInteger(index));
+            break;
+        case ConfigHandler::FLOAT_TYPE:
+            snapshot->appendFloat(source->getFloat(index));
+            break;
+        case ConfigHandler::BOOL_TYPE:
+            snapshot->appendBoolean(source->getBoolean(index));
+            break;
+        case ConfigHandler::STRING_ARRAY_TYPE:
+            snapshot->appendStringArray(source->getStringArray(index));
+            break;
+        case ConfigHandler::DURATION_TYPE:
+        case ConfigHandler::BYTE_SIZE_TYPE:
+        case ConfigHandler::UNDEFINED_TYPE:
+            break;
+    }
+}
+
+/**
+ * @brief write a new cache-file. The file is written under a temporary name and renamed at the
+ *        end, so other processes, which start at the same time, never read a half written file.
+ *
+ * @param cacheFilePath path of the cache-file
+ * @param contentHash hash of the config-file
+ * @param entries registered items per type, ordered by the index of their values
+ * @param values values of the registered items
+ * @param error reference for error-output
+ *
+ * @return false, if writing the file failed, else true
+ */
+bool
+ConfigCache::writeCache(const std::string &cacheFilePath,
+                        const uint64_t contentHash,
+                        const std::vector<std::vector<CacheEntry>> &entries,
+                        const ConfigSnapshot &values,
+                        ErrorContainer &error)
+{
+    std::string output;
+
+    // write header
+    output.append(CONFIG_CACHE_MAGIC, sizeof(CONFIG_CACHE_MAGIC));
+    appendBinary(output, static_cast<uint32_t>(CONFIG_CACHE_VERSION));
+    appendBinary(output, static_cast<uint32_t>(sizeof(long)));
+    appendBinary(output, contentHash);
+    appendBinary(output, hashSchema(entries));
+
+    // write registered items
+    for(uint32_t type = ConfigHandler::STRING_TYPE; type < entries.size(); type++)
+    {
+        appendBinary(output, static_cast<uint32_t>(entries[type].size()));
+        for(const CacheEntry &entry : entries[type])
+        {
+            const uint8_t flags = (entry.required ? 1 : 0) | (entry.inFile ? 2 : 0);
+            appendBinary(output, flags);
+            appendBinary(output, static_cast<uint8_t>(entry.type));
+            appendString(output, entry.groupName);
+            appendString(output, entry.itemName);
+        }
+    }
+
+    // write values
+    values.serialize(output);
+
+    const std::string tempFilePath = cacheFilePath + "." + std::to_string(getpid()) + ".tmp";
+    std::ofstream outputFile(tempFilePath, std::ios::binary | std::ios::trunc);
+    outputFile.write(output.data(), output.size());
+    outputFile.close();
+    if(outputFile.fail())
+    {
+        std::remove(tempFilePath.c_str());
+        error.addMeesage("Failed to write config-cache \"" + cacheFilePath + "\"");
+        return false;
+    }
+
+    if(std::rename(tempFilePath.c_str(), cacheFilePath.c_str()) != 0)
+    {
+        std::remove(tempFilePath.c_str());
+        error.addMeesage("Failed to write config-cache \"" + cacheFilePath + "\"");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief calculate FNV-1a hash of a block of data
+ *
+ * @param data pointer to the data
+ * @param size number of bytes
+ * @param hash start-value to continue a hash over multiple blocks
+ *
+ * @return hash of the data
+ */
+uint64_t
+ConfigCache::hashData(const char* data,
+                      const uint64_t size,
+                      uint64_t hash)
+{
+    for(uint64_t i = 0; i < size; i++)
+    {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief calculate hash of all registered items
+ *
+ * @param entries registered items per type, ordered by the index of their values
+ *
+ * @return hash of the registrations
+ */
+uint64_t
+ConfigCache::hashSchema(const std::vector<std::vector<CacheEntry>> &entries)
+{
+    uint64_t hash = CONFIG_HASH_SEED;
+    for(uint32_t type = ConfigHandler::STRING_TYPE; type < entries.size(); type++)
+    {
+        const uint32_t numberOfEntries = entries[type].size();
+        hash = hashData(reinterpret_cast<const char*>(&type), sizeof(type), hash);
+        hash = hashData(reinterpret_cast<const char*>(&numberOfEntries), sizeof(uint32_t), hash);
+        for(const CacheEntry &entry : entries[type])
+        {
+            // the terminating null-characters separate group- and item-name
+            hash = hashData(entry.groupName.c_str(), entry.groupName.size() + 1, hash);
+            hash = hashData(entry.itemName.c_str(), entry.itemName.size() + 1, hash);
+            hash = hashData(entry.required ? "r" : "o", 1, hash);
+            hash = hashData(reinterpret_cast<const char*>(&entry.type), sizeof(entry.type), hash);
+        }
+    }
+
+    return hash;
+}
+
+} // namespace Kitsunemimi
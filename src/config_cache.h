@@ -0,0 +1,85 @@
+/**
+ *  @file       config_cache.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_CACHE_H
+#define CONFIG_CACHE_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include <libKitsunemimiConfig/config_handler.h>
+#include <config_snapshot.h>
+
+#define CONFIG_CACHE_VERSION 2
+#define CONFIG_HASH_SEED 14695981039346656037ull
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief precompiled form of a config-file together with the registered items, which were
+ *        validated against this file. As long as the config-file and the registrations are the
+ *        same like at the time, when the cache was written, the values can be taken from the
+ *        cache without parsing and checking the config-file again.
+ *
+ *        Layout of the cache-file:
+ *            header (magic, version, size of long, hash of the config-file, hash of the schema)
+ *            registered items with their type per value-list, ordered by the index of their values
+ *            serialized values in form of a snapshot
+ */
+class ConfigCache
+{
+public:
+    struct CacheEntry
+    {
+        std::string groupName = "";
+        std::string itemName = "";
+        ConfigHandler::ConfigType type = ConfigHandler::UNDEFINED_TYPE;
+        bool required = false;
+        bool inFile = false;
+    };
+
+    ConfigCache();
+    ~ConfigCache();
+
+    bool parseCache(const std::string &input,
+                    const uint64_t contentHash);
+    bool matches(const std::string &groupName,
+                 const std::string &itemName,
+                 const ConfigHandler::ConfigType type,
+                 const bool required,
+                 const uint32_t index) const;
+    bool isInFile(const ConfigHandler::ConfigType type,
+                  const uint32_t index) const;
+    void appendValue(ConfigSnapshot* snapshot,
+                     const ConfigSnapshot* defaults,
+                     const ConfigHandler::ConfigType type,
+                     const uint32_t index) const;
+
+    static bool writeCache(const std::string &cacheFilePath,
+                           const uint64_t contentHash,
+                           const std::vector<std::vector<CacheEntry>> &entries,
+                           const ConfigSnapshot &values,
+                           ErrorContainer &error);
+    static uint64_t hashData(const char* data,
+                             const uint64_t size,
+                             uint64_t hash = CONFIG_HASH_SEED);
+    static uint64_t hashSchema(const std::vector<std::vector<CacheEntry>> &entries);
+
+    uint64_t schemaHash = 0;
+
+private:
+    // registered items per type of the value-list, ordered by the index of their values
+    std::vector<std::vector<CacheEntry>> m_entries;
+    ConfigSnapshot m_values;
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_CACHE_H
@@ -7,11 +7,20 @@
  */
 
 #include <libKitsunemimiConfig/config_handler.h>
+#include <config_snapshot.h>
+#include <config_cache.h>
+#include <config_registry.h>
+#include <config_access_stats.h>
+#include <config_memory_usage.h>
 
 #include <libKitsunemimiCommon/items/data_items.h>
-#include <libKitsunemimiCommon/files/text_file.h>
 #include <libKitsunemimiIni/ini_item.h>
 
+#include <thread>
+#include <atomic>
+#include <tuple>
+#include <algorithm>
+
 namespace Kitsunemimi
 {
 
@@ -22,12 +31,38 @@ ConfigHandler* ConfigHandler::m_config = nullptr;
  *
  * @param configFilePath absolute path to the config-file to read
  * @param error reference for error-output
+ * @param cacheFilePath optional path to a precompiled cache of the config-file
  *
  * @return false, if reading or parsing the file failed, else true
  */
 bool
 initConfig(const std::string &configFilePath,
-           ErrorContainer &error)
+           ErrorContainer &error,
+           const std::string &cacheFilePath)
+{
+    if(ConfigHandler::m_config != nullptr)
+    {
+        LOG_WARNING("config is already initialized.");
+        return true;
+    }
+
+    ConfigHandler::m_config = new ConfigHandler();
+    return ConfigHandler::m_config->initConfig(configFilePath, error, cacheFilePath);
+}
+
+/**
+ * @brief read all sources of the config
+ *
+ * @param sources config-files and overrides of the config
+ * @param error reference for error-output
+ * @param cacheFilePath optional path to a precompiled cache of the sources
+ *
+ * @return false, if reading or parsing a source failed, else true
+ */
+bool
+initConfig(const ConfigSources &sources,
+           ErrorContainer &error,
+           const std::string &cacheFilePath)
 {
     if(ConfigHandler::m_config != nullptr)
     {
@@ -36,7 +71,7 @@ initConfig(const std::string &configFilePath,
     }
 
     ConfigHandler::m_config = new ConfigHandler();
-    return ConfigHandler::m_config->initConfig(configFilePath, error);
+    return ConfigHandler::m_config->initConfig(sources, error, cacheFilePath);
 }
 
 /**
@@ -54,6 +89,50 @@ isConfigValid()
     return ConfigHandler::m_config->isConfigValid();
 }
 
+/**
+ * @brief read the config-file again and publish the new values, without blocking any reader
+ *
+ * @param error reference for error-output
+ *
+ * @return false, if config is not sealed or the new config-file is invalid, else true
+ */
+bool
+reloadConfig(ErrorContainer &error)
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return false;
+    }
+
+    return ConfigHandler::m_config->reloadConfig(error);
+}
+
+/**
+ * @brief finish the registration-phase and compact the storage of the registered values
+ */
+void
+sealConfig()
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return;
+    }
+
+    ConfigHandler::m_config->sealConfig();
+}
+
+/**
+ * @brief seal the config and disable any further reload, so the getter can read the values
+ *        without registering as reader
+ */
+void
+freezeConfig()
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return;
+    }
+
+    ConfigHandler::m_config->freezeConfig();
+}
+
 /**
  * @brief reset configuration (primary to test different configs in one test)
  */
@@ -67,6 +146,157 @@ resetConfig()
     }
 }
 
+/**
+ * @brief read the config-file again and validate it against all registered items. Only the
+ *        groups, whose text has changed since the last successful load, are parsed and validated
+ *        again. All other values are copied from the current values. The new values
+ *        are published with a single atomic pointer-swap, so readers never see a half-applied
+ *        config and are never blocked. The old values are deleted, when all readers, which
+ *        started before the swap, are finished. If the new config-file is invalid, the old values
+ *        stay active.
+ *
+ * @param error reference for error-output
+ *
+ * @return false, if config is not sealed or the new config-file is invalid, else true
+ */
+bool
+ConfigHandler::reloadConfig(ErrorContainer &error)
+{
+    std::vector<ConfigChange> changes;
+    {
+        // only one reload at the same time, readers are not affected by this lock
+        std::lock_guard<std::mutex> guard(m_reloadLock);
+
+        // the set of registered items must be final for a reload
+        if(m_sealed == false)
+        {
+            error.addMeesage("Config reload failed because config is not sealed yet");
+            LOG_ERROR(error);
+            return false;
+        }
+
+        // getter of a frozen config read the values without registering as reader
+        if(m_frozen.load())
+        {
+            error.addMeesage("Config reload failed because config is frozen");
+            LOG_ERROR(error);
+            return false;
+        }
+
+        // overlays reference the current values
+        if(m_numberOfOverlays.load() > 0)
+        {
+            error.addMeesage("Config reload failed because config is the base of other configs");
+            LOG_ERROR(error);
+            return false;
+        }
+
+        // read sources
+        std::vector<SourceContent> contents;
+        if(readSources(contents, error) == false)
+        {
+            LOG_ERROR(error);
+            return false;
+        }
+
+        // find changed groups
+        std::map<std::string, uint64_t> newGroupHashes;
+        hashSources(contents, newGroupHashes);
+        std::set<std::string> changedGroups;
+        for(const auto& [groupName, hash] : newGroupHashes)
+        {
+            const auto oldHash = m_groupHashes.find(groupName);
+            if(oldHash == m_groupHashes.end()
+                    || oldHash->second != hash)
+            {
+                changedGroups.insert(groupName);
+            }
+        }
+        for(const auto& [groupName, hash] : m_groupHashes)
+        {
+            if(newGroupHashes.count(groupName) == 0) {
+                changedGroups.insert(groupName);
+            }
+        }
+
+        if(changedGroups.size() == 0) {
+            return true;
+        }
+
+        // parse only the changed groups. Lines before the first group can affect everything,
+        // so in this case the whole file is parsed and validated again. The file of an overlay
+        // contains only the overridden values, so it is always parsed completely.
+        const bool fullReload = changedGroups.count("") > 0 || m_baseConfig != nullptr;
+        IniItem newIniItem;
+        ValueOrigins newOrigins;
+        if(parseSources(contents,
+                        fullReload ? nullptr : &changedGroups,
+                        newIniItem,
+                        newOrigins,
+                        error) == false)
+        {
+            LOG_ERROR(error);
+            return false;
+        }
+
+        // build new snapshot. The snapshot can not be swapped in the meantime, because only the
+        // reload swaps it and the reload-lock is held.
+        ConfigSnapshot* newSnapshot = nullptr;
+        if(m_baseConfig != nullptr)
+        {
+            newSnapshot = buildOverlaySnapshot(newIniItem, "Config reload failed", error);
+        }
+        else if(fullReload)
+        {
+            newSnapshot = buildSnapshot(newIniItem, "Config reload failed", error);
+        }
+        else
+        {
+            newSnapshot = buildSnapshot(newIniItem,
+                                        "Config reload failed",
+                                        error,
+                                        m_snapshot.load(),
+                                        &changedGroups);
+        }
+
+        if(newSnapshot == nullptr)
+        {
+            LOG_ERROR(error);
+            return false;
+        }
+        newSnapshot->compact();
+
+        m_groupHashes = std::move(newGroupHashes);
+        if(fullReload)
+        {
+            m_valueOrigins = std::move(newOrigins);
+            m_valueOriginsLoaded = true;
+        }
+        else if(m_valueOriginsLoaded)
+        {
+            for(const std::string &groupName : changedGroups) {
+                m_valueOrigins.erase(groupName);
+            }
+            for(auto& [groupName, items] : newOrigins) {
+                m_valueOrigins[groupName] = std::move(items);
+            }
+        }
+
+        // publish new snapshot and delete the old one, after all readers of the old one are
+        // finished
+        ConfigSnapshot* oldSnapshot = m_snapshot.exchange(newSnapshot);
+        collectChanges(oldSnapshot, newSnapshot, changes);
+        waitForReaders();
+        delete oldSnapshot;
+    }
+
+    // readers already see the new values, when the subscribers are notified. The reload-lock is
+    // already released, so callbacks can use the functions, which take this lock too.
+    notifySubscribers(changes);
+
+    return true;
+}
+
 /**
  * @brief register string config value
  *
@@ -75,8 +305,10 @@ resetConfig()
  * @param error reference for error-output
  * @param defaultValue default value, if nothing was set inside of the config
  * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the registration failed
  */
-void
+ConfigKey<std::string>
 registerString(const std::string &groupName,
                const std::string &itemName,
                ErrorContainer &error,
@@ -84,10 +316,14 @@ registerString(const std::string &groupName,
                const bool required)
 {
     if(ConfigHandler::m_config == nullptr) {
-        return;
+        return ConfigKey<std::string>();
     }
 
-    ConfigHandler::m_config->registerString(groupName, itemName, error, defaultValue, required);
+    return ConfigHandler::m_config->registerString(groupName,
+                                                   itemName,
+                                                   error,
+                                                   defaultValue,
+                                                   required);
 }
 
 /**
@@ -98,8 +334,10 @@ registerString(const std::string &groupName,
  * @param error reference for error-output
  * @param defaultValue default value, if nothing was set inside of the config
  * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the registration failed
  */
-void
+ConfigKey<long>
 registerInteger(const std::string &groupName,
                 const std::string &itemName,
                 ErrorContainer &error,
@@ -107,10 +345,14 @@ registerInteger(const std::string &groupName,
                 const bool required)
 {
     if(ConfigHandler::m_config == nullptr) {
-        return;
+        return ConfigKey<long>();
     }
 
-    ConfigHandler::m_config->registerInteger(groupName, itemName, error, defaultValue, required);
+    return ConfigHandler::m_config->registerInteger(groupName,
+                                                    itemName,
+                                                    error,
+                                                    defaultValue,
+                                                    required);
 }
 
 /**
@@ -121,8 +363,10 @@ registerInteger(const std::string &groupName,
  * @param error reference for error-output
  * @param defaultValue default value, if nothing was set inside of the config
  * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the registration failed
  */
-void
+ConfigKey<double>
 registerFloat(const std::string &groupName,
               const std::string &itemName,
               ErrorContainer &error,
@@ -130,10 +374,14 @@ registerFloat(const std::string &groupName,
               const bool required)
 {
     if(ConfigHandler::m_config == nullptr) {
-        return;
+        return ConfigKey<double>();
     }
 
-    ConfigHandler::m_config->registerFloat(groupName, itemName, error, defaultValue, required);
+    return ConfigHandler::m_config->registerFloat(groupName,
+                                                  itemName,
+                                                  error,
+                                                  defaultValue,
+                                                  required);
 }
 
 /**
@@ -144,8 +392,10 @@ registerFloat(const std::string &groupName,
  * @param error reference for error-output
  * @param defaultValue default value, if nothing was set inside of the config
  * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the registration failed
  */
-void
+ConfigKey<bool>
 registerBoolean(const std::string &groupName,
                 const std::string &itemName,
                 ErrorContainer &error,
@@ -153,10 +403,14 @@ registerBoolean(const std::string &groupName,
                 const bool required)
 {
     if(ConfigHandler::m_config == nullptr) {
-        return;
+        return ConfigKey<bool>();
     }
 
-    ConfigHandler::m_config->registerBoolean(groupName, itemName, error, defaultValue, required);
+    return ConfigHandler::m_config->registerBoolean(groupName,
+                                                    itemName,
+                                                    error,
+                                                    defaultValue,
+                                                    required);
 }
 
 /**
@@ -167,8 +421,10 @@ registerBoolean(const std::string &groupName,
  * @param error reference for error-output
  * @param defaultValue default value, if nothing was set inside of the config
  * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the registration failed
  */
-void
+ConfigKey<std::vector<std::string>>
 registerStringArray(const std::string &groupName,
                     const std::string &itemName,
                     ErrorContainer &error,
@@ -176,10 +432,115 @@ registerStringArray(const std::string &groupName,
                     const bool required)
 {
     if(ConfigHandler::m_config == nullptr) {
-        return;
+        return ConfigKey<std::vector<std::string>>();
+    }
+
+    return ConfigHandler::m_config->registerStringArray(groupName,
+                                                         itemName,
+                                                         error,
+                                                         defaultValue,
+                                                         required);
+}
+
+/**
+ * @brief register duration config value
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param error reference for error-output
+ * @param defaultValue default value, if nothing was set inside of the config
+ * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the registration failed
+ */
+ConfigKey<std::chrono::nanoseconds>
+registerDuration(const std::string &groupName,
+                 const std::string &itemName,
+                 ErrorContainer &error,
+                 const std::chrono::nanoseconds defaultValue,
+                 const bool required)
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return ConfigKey<std::chrono::nanoseconds>();
+    }
+
+    return ConfigHandler::m_config->registerDuration(groupName,
+                                                     itemName,
+                                                     error,
+                                                     defaultValue,
+                                                     required);
+}
+
+/**
+ * @brief register byte-size config value
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param error reference for error-output
+ * @param defaultValue default value in bytes, if nothing was set inside of the config
+ * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the registration failed
+ */
+ConfigKey<uint64_t>
+registerByteSize(const std::string &groupName,
+                 const std::string &itemName,
+                 ErrorContainer &error,
+                 const uint64_t defaultValue,
+                 const bool required)
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return ConfigKey<uint64_t>();
+    }
+
+    return ConfigHandler::m_config->registerByteSize(groupName,
+                                                     itemName,
+                                                     error,
+                                                     defaultValue,
+                                                     required);
+}
+
+/**
+ * @brief register a whole schema at once
+ *
+ * @param schema list of items to register
+ * @param error reference for error-output
+ *
+ * @return false, if at least one item of the schema failed, else true
+ */
+bool
+registerSchema(const std::vector<ConfigSpec> &schema,
+               ErrorContainer &error)
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return false;
     }
 
-    ConfigHandler::m_config->registerStringArray(groupName, itemName, error, defaultValue,required);
+    return ConfigHandler::m_config->registerSchema(schema, error);
+}
+
+/**
+ * @brief register a whole schema at once and get the indexes of the registered items
+ *
+ * @param schema list of items to register
+ * @param error reference for error-output
+ * @param indexes reference for the indexes of the items in order of the schema, which are
+ *                UNREGISTERED_CONFIG_KEY for failed items
+ *
+ * @return false, if at least one item of the schema failed, else true
+ */
+bool
+registerSchema(const std::vector<ConfigSpec> &schema,
+               ErrorContainer &error,
+               std::vector<uint32_t> &indexes)
+{
+    if(ConfigHandler::m_config == nullptr)
+    {
+        indexes.assign(schema.size(), UNREGISTERED_CONFIG_KEY);
+        return false;
+    }
+
+    return ConfigHandler::m_config->registerSchema(schema, error, indexes);
 }
 
 /**
@@ -194,8 +555,8 @@ registerStringArray(const std::string &groupName,
  *         config-file or the defined default-value.
  */
 const std::string
-getString(const std::string &groupName,
-          const std::string &itemName,
+getString(std::string_view groupName,
+          std::string_view itemName,
           bool &success)
 {
     success = true;
@@ -221,8 +582,8 @@ getString(const std::string &groupName,
  *         config-file or the defined default-value.
  */
 long
-getInteger(const std::string &groupName,
-           const std::string &itemName,
+getInteger(std::string_view groupName,
+           std::string_view itemName,
            bool &success)
 {
     success = true;
@@ -248,8 +609,8 @@ getInteger(const std::string &groupName,
  *         config-file or the defined default-value.
  */
 double
-getFloat(const std::string &groupName,
-         const std::string &itemName,
+getFloat(std::string_view groupName,
+         std::string_view itemName,
          bool &success)
 {
     success = true;
@@ -275,8 +636,8 @@ getFloat(const std::string &groupName,
  *         config-file or the defined default-value.
  */
 bool
-getBoolean(const std::string &groupName,
-           const std::string &itemName,
+getBoolean(std::string_view groupName,
+           std::string_view itemName,
            bool &success)
 {
     success = true;
@@ -302,8 +663,8 @@ getBoolean(const std::string &groupName,
  *         config-file or the defined default-value.
  */
 const std::vector<std::string>
-getStringArray(const std::string &groupName,
-               const std::string &itemName,
+getStringArray(std::string_view groupName,
+               std::string_view itemName,
                bool &success)
 {
     std::vector<std::string> result;
@@ -319,517 +680,3578 @@ getStringArray(const std::string &groupName,
 }
 
 /**
- * @brief ConfigHandler::ConfigHandler
- */
-ConfigHandler::ConfigHandler() {}
-
-/**
- * @brief ConfigHandler::~ConfigHandler
- */
-ConfigHandler::~ConfigHandler()
-{
-    delete m_iniItem;
-}
-
-/**
- * @brief read a ini config-file
+ * @brief get duration-value from config
  *
- * @param configFilePath absolute path to the config-file to read
- * @param error reference for error-output
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
  *
- * @return false, if reading or parsing the file failed, else true
+ * @return 0, if item-name and group-name are not registered, else value from the
+ *         config-file or the defined default-value.
  */
-bool
-ConfigHandler::initConfig(const std::string &configFilePath,
-                          ErrorContainer &error)
+std::chrono::nanoseconds
+getDuration(std::string_view groupName,
+            std::string_view itemName,
+            bool &success)
 {
-    // read file
-    m_configFilePath = configFilePath;
-    std::string fileContent = "";
-    bool ret = readFile(fileContent, m_configFilePath, error);
-    if(ret == false)
-    {
-        error.addMeesage("Error while reading config-file \"" + configFilePath + "\"");
-        LOG_ERROR(error);
-        return false;
-    }
+    success = true;
 
-    // parse file content
-    m_iniItem = new IniItem();
-    std::string parseErrorMessage = "";
-    bool result = m_iniItem->parse(fileContent, error);
-    if(result == false)
+    if(ConfigHandler::m_config == nullptr)
     {
-        error.addMeesage("Error while parsing config-file \"" + configFilePath + "\"");
-        return false;
+        success = false;
+        return std::chrono::nanoseconds(0);
     }
 
-    return true;
+    return ConfigHandler::m_config->getDuration(groupName, itemName, success);
 }
 
 /**
- * @brief request if config is valid
+ * @brief get byte-size-value from config
  *
- * @return true, if valid, else false
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return 0, if item-name and group-name are not registered, else value in bytes from the
+ *         config-file or the defined default-value.
  */
-bool
-ConfigHandler::isConfigValid() const
+uint64_t
+getByteSize(std::string_view groupName,
+            std::string_view itemName,
+            bool &success)
 {
-    return m_configValid;
+    success = true;
+
+    if(ConfigHandler::m_config == nullptr)
+    {
+        success = false;
+        return 0;
+    }
+
+    return ConfigHandler::m_config->getByteSize(groupName, itemName, success);
 }
 
 /**
- * @brief register string config value
+ * @brief get string-value from config by its handle
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param error reference for error-output
- * @param defaultValue default value, if nothing was set inside of the config
- * @param required if true, then the value must be in the config-file (default: false)
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
  *
- * @return false, if false type or item-name and group-name are already registered
+ * @return empty string, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
  */
-void
-ConfigHandler::registerString(const std::string &groupName,
-                              const std::string &itemName,
-                              ErrorContainer &error,
-                              const std::string &defaultValue,
-                              const bool required)
+const std::string
+getString(const ConfigKey<std::string> &key,
+          bool &success)
 {
-    std::string finalGroupName = groupName;
-    if(registerValue(finalGroupName, itemName, STRING_TYPE, required, error) == false) {
-        return;
+    if(ConfigHandler::m_config == nullptr)
+    {
+        success = false;
+        return "";
     }
 
-    // set default-type, in case the nothing was already set
-    m_iniItem->set(finalGroupName, itemName, defaultValue);
-
-    return;
+    return ConfigHandler::m_config->getString(key, success);
 }
 
 /**
- * @brief register int/long config value
+ * @brief get long-value from config by its handle
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param error reference for error-output
- * @param defaultValue default value, if nothing was set inside of the config
- * @param required if true, then the value must be in the config-file (default: false)
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
  *
- * @return false, if false type or item-name and group-name are already registered
+ * @return 0, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
  */
-void
-ConfigHandler::registerInteger(const std::string &groupName,
-                               const std::string &itemName,
-                               ErrorContainer &error,
-                               const long defaultValue,
-                               const bool required)
+long
+getInteger(const ConfigKey<long> &key,
+           bool &success)
 {
-    std::string finalGroupName = groupName;
-    if(registerValue(finalGroupName, itemName, INT_TYPE, required, error) == false) {
-        return;
+    if(ConfigHandler::m_config == nullptr)
+    {
+        success = false;
+        return 0;
     }
 
-    // set default-type, in case the nothing was already set
-    m_iniItem->set(finalGroupName, itemName, defaultValue);
-
-    return;
+    return ConfigHandler::m_config->getInteger(key, success);
 }
 
 /**
- * @brief register float/double config value
+ * @brief get double-value from config by its handle
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param error reference for error-output
- * @param defaultValue default value, if nothing was set inside of the config
- * @param required if true, then the value must be in the config-file (default: false)
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
  *
- * @return false, if false type or item-name and group-name are already registered
+ * @return 0.0, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
  */
-void
-ConfigHandler::registerFloat(const std::string &groupName,
-                             const std::string &itemName,
-                             ErrorContainer &error,
-                             const double defaultValue,
-                             const bool required)
+double
+getFloat(const ConfigKey<double> &key,
+         bool &success)
 {
-    std::string finalGroupName = groupName;
-    if(registerValue(finalGroupName, itemName, FLOAT_TYPE, required, error) == false) {
-        return;
+    if(ConfigHandler::m_config == nullptr)
+    {
+        success = false;
+        return 0.0;
     }
 
-    // set default-type, in case the nothing was already set
-    m_iniItem->set(finalGroupName, itemName, defaultValue);
-
-    return;
+    return ConfigHandler::m_config->getFloat(key, success);
 }
 
 /**
- * @brief register bool config value
+ * @brief get bool-value from config by its handle
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param error reference for error-output
- * @param defaultValue default value, if nothing was set inside of the config
- * @param required if true, then the value must be in the config-file (default: false)
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
  *
- * @return false, if false type or item-name and group-name are already registered
+ * @return false, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
  */
-void
-ConfigHandler::registerBoolean(const std::string &groupName,
-                               const std::string &itemName,
-                               ErrorContainer &error,
-                               const bool defaultValue,
-                               const bool required)
+bool
+getBoolean(const ConfigKey<bool> &key,
+           bool &success)
 {
-    std::string finalGroupName = groupName;
-    if(registerValue(finalGroupName, itemName, BOOL_TYPE, required, error) == false) {
-        return;
+    if(ConfigHandler::m_config == nullptr)
+    {
+        success = false;
+        return false;
     }
 
-    // set default-type, in case the nothing was already set
-    m_iniItem->set(finalGroupName, itemName, defaultValue);
-
-    return;
+    return ConfigHandler::m_config->getBoolean(key, success);
 }
 
 /**
- * @brief register string-array config value
+ * @brief get string-array-value from config by its handle
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param defaultValue default value, if nothing was set inside of the config
- * @param required if true, then the value must be in the config-file (default: false)
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
  *
- * @return false, if false type or item-name and group-name are already registered
+ * @return empty string-array, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
  */
-void
-ConfigHandler::registerStringArray(const std::string &groupName,
-                                   const std::string &itemName,
-                                   ErrorContainer &error,
-                                   const std::vector<std::string> &defaultValue,
-                                   const bool required)
+const std::vector<std::string>
+getStringArray(const ConfigKey<std::vector<std::string>> &key,
+               bool &success)
 {
-    std::string finalGroupName = groupName;
-    if(registerValue(finalGroupName, itemName, STRING_ARRAY_TYPE, required, error) == false) {
-        return;
+    if(ConfigHandler::m_config == nullptr)
+    {
+        success = false;
+        return std::vector<std::string>();
     }
 
-    // set default-type, in case the nothing was already set
-    m_iniItem->set(finalGroupName, itemName, defaultValue);
-
-    return;
+    return ConfigHandler::m_config->getStringArray(key, success);
 }
 
 /**
- * @brief get string-value from config
+ * @brief get duration-value from config by its handle
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param success reference to bool-value with the result. returns false if item-name and group-name
- *                are not registered, else true.
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
  *
- * @return empty string, if item-name and group-name are not registered, else value from the
- *         config-file or the defined default-value.
+ * @return 0, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
  */
-const std::string
-ConfigHandler::getString(const std::string &groupName,
-                         const std::string &itemName,
-                         bool &success)
+std::chrono::nanoseconds
+getDuration(const ConfigKey<std::chrono::nanoseconds> &key,
+            bool &success)
 {
-    success = true;
-
-    // compare with registered type
-    if(getRegisteredType(groupName, itemName) != ConfigType::STRING_TYPE)
+    if(ConfigHandler::m_config == nullptr)
     {
         success = false;
-        return "";
+        return std::chrono::nanoseconds(0);
     }
 
-    // get value from config
-    return m_iniItem->get(groupName, itemName)->toValue()->getString();
+    return ConfigHandler::m_config->getDuration(key, success);
 }
 
 /**
- * @brief get long-value from config
+ * @brief get byte-size-value from config by its handle
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param success reference to bool-value with the result. returns false if item-name and group-name
- *                are not registered, else true.
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
  *
- * @return 0, if item-name and group-name are not registered, else value from the
- *         config-file or the defined default-value.
+ * @return 0, if the handle is invalid, else value in bytes from the config-file or the
+ *         defined default-value.
  */
-long
-ConfigHandler::getInteger(const std::string &groupName,
-                          const std::string &itemName,
-                          bool &success)
+uint64_t
+getByteSize(const ConfigKey<uint64_t> &key,
+            bool &success)
 {
-    success = true;
-
-    // compare with registered type
-    if(getRegisteredType(groupName, itemName) != ConfigType::INT_TYPE)
+    if(ConfigHandler::m_config == nullptr)
     {
         success = false;
-        return 0l;
+        return 0;
     }
 
-    // get value from config
-    return m_iniItem->get(groupName, itemName)->toValue()->getLong();
+    return ConfigHandler::m_config->getByteSize(key, success);
 }
 
 /**
- * @brief get double-value from config
+ * @brief get string-value from config without copy
  *
  * @param groupName name of the group
  * @param itemName name of the item within the group
  * @param success reference to bool-value with the result. returns false if item-name and group-name
  *                are not registered, else true.
  *
- * @return 0.0, if item-name and group-name are not registered, else value from the
- *         config-file or the defined default-value.
+ * @return empty view, if item-name and group-name are not registered, else view on the value.
+ *         The view is valid until the next reload or reset of the config.
  */
-double
-ConfigHandler::getFloat(const std::string &groupName,
-                        const std::string &itemName,
-                        bool &success)
+std::string_view
+getStringView(std::string_view groupName,
+              std::string_view itemName,
+              bool &success)
 {
-    success = true;
-
-    // compare with registered type
-    if(getRegisteredType(groupName, itemName) != ConfigType::FLOAT_TYPE)
+    if(ConfigHandler::m_config == nullptr)
     {
         success = false;
-        return 0.0;
+        return std::string_view();
     }
 
-    // get value from config
-    return m_iniItem->get(groupName, itemName)->toValue()->getDouble();
+    return ConfigHandler::m_config->getStringView(groupName, itemName, success);
 }
 
 /**
- * @brief get bool-value from config
+ * @brief get string-value from config by its handle without copy
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param success reference to bool-value with the result. returns false if item-name and group-name
- *                are not registered, else true.
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
  *
- * @return false, if item-name and group-name are not registered, else value from the
- *         config-file or the defined default-value.
+ * @return empty view, if the handle is invalid, else view on the value. The view is valid until
+ *         the next reload or reset of the config.
  */
-bool
-ConfigHandler::getBoolean(const std::string &groupName,
-                          const std::string &itemName,
-                          bool &success)
+std::string_view
+getStringView(const ConfigKey<std::string> &key,
+              bool &success)
 {
-    success = true;
-
-    // compare with registered type
-    if(getRegisteredType(groupName, itemName) != ConfigType::BOOL_TYPE)
+    if(ConfigHandler::m_config == nullptr)
     {
         success = false;
-        return false;
+        return std::string_view();
     }
 
-    // get value from config
-    return m_iniItem->get(groupName, itemName)->toValue()->getBool();
+    return ConfigHandler::m_config->getStringView(key, success);
 }
 
 /**
- * @brief get string-array-value from config
+ * @brief get string-array-value from config without copy
  *
  * @param groupName name of the group
  * @param itemName name of the item within the group
  * @param success reference to bool-value with the result. returns false if item-name and group-name
  *                are not registered, else true.
  *
- * @return empty string-array, if item-name and group-name are not registered, else value from the
- *         config-file or the defined default-value.
+ * @return empty view, if item-name and group-name are not registered, else view on the value.
+ *         The view is valid until the next reload or reset of the config.
  */
-const std::vector<std::string>
-ConfigHandler::getStringArray(const std::string &groupName,
-                              const std::string &itemName,
-                              bool &success)
+StringArrayView
+getStringArrayView(std::string_view groupName,
+                   std::string_view itemName,
+                   bool &success)
 {
-    std::vector<std::string> result;
-    success = true;
-
-    // compare with registered type
-    if(getRegisteredType(groupName, itemName) != ConfigType::STRING_ARRAY_TYPE)
+    if(ConfigHandler::m_config == nullptr)
     {
         success = false;
-        return result;
-    }
-
-    // get and transform result from the config-file
-    DataArray* array = m_iniItem->get(groupName, itemName)->toArray();
-    for(uint32_t i = 0; i < array->size(); i++)
-    {
-        result.push_back(array->get(i)->toValue()->getString());
+        return StringArrayView();
     }
 
-    return result;
+    return ConfigHandler::m_config->getStringArrayView(groupName, itemName, success);
 }
 
 /**
- * @brief check if defined type match with the type of the value within the config-file
+ * @brief get string-array-value from config by its handle without copy
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param type type-identifier
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
  *
- * @return true, if type match with the config-file, else false
+ * @return empty view, if the handle is invalid, else view on the value. The view is valid until
+ *         the next reload or reset of the config.
  */
-bool
-ConfigHandler::checkType(const std::string &groupName,
-                         const std::string &itemName,
-                         const ConfigType type)
+StringArrayView
+getStringArrayView(const ConfigKey<std::vector<std::string>> &key,
+                   bool &success)
 {
-    // get value from config-file
-    DataItem* currentItem = m_iniItem->get(groupName, itemName);
-
-    // precheck
-    if(currentItem == nullptr) {
-        return true;
-    }
-
-    // check for array
-    if(currentItem->getType() == DataItem::ARRAY_TYPE
-            && type == ConfigType::STRING_ARRAY_TYPE)
-    {
-        return true;
-    }
-
-    // check value
-    if(currentItem->getType() == DataItem::VALUE_TYPE)
+    if(ConfigHandler::m_config == nullptr)
     {
-        DataValue* value = currentItem->toValue();
-
-        // check string
-        if(value->getValueType() == DataValue::STRING_TYPE
-                && type == ConfigType::STRING_TYPE)
-        {
-            return true;
-        }
-
-        // check integer
-        if(value->getValueType() == DataValue::INT_TYPE
-                && type == ConfigType::INT_TYPE)
-        {
-            return true;
-        }
-
-        // check float
-        if(value->getValueType() == DataValue::FLOAT_TYPE
-                && type == ConfigType::FLOAT_TYPE)
-        {
-            return true;
-        }
-
-        // check boolean
-        if(value->getValueType() == DataValue::BOOL_TYPE
-                && type == ConfigType::BOOL_TYPE)
-        {
-            return true;
-        }
+        success = false;
+        return StringArrayView();
     }
 
-    return false;
+    return ConfigHandler::m_config->getStringArrayView(key, success);
 }
 
 /**
- * @brief check, if an item-name and group-name are already registered
+ * @brief get the source of the current value of a registered item
  *
  * @param groupName name of the group
  * @param itemName name of the item within the group
+ * @param origin reference for the file-path or the origin of the override, which has set the value
  *
- * @return true, if item-name and group-name is already registered, else false
+ * @return UNDEFINED_SOURCE, if the item is not registered, else source of the value
  */
-bool
-ConfigHandler::isRegistered(const std::string &groupName,
-                            const std::string &itemName)
+ConfigHandler::ConfigSource
+getValueSource(const std::string &groupName,
+               const std::string &itemName,
+               std::string &origin)
 {
-    if(getRegisteredType(groupName, itemName) == ConfigType::UNDEFINED_TYPE) {
-        return false;
+    if(ConfigHandler::m_config == nullptr) {
+        return ConfigHandler::UNDEFINED_SOURCE;
     }
 
-    return true;
+    return ConfigHandler::m_config->getValueSource(groupName, itemName, origin);
 }
 
 /**
- * @brief register type
- *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- * @param type type-identifier to register
+ * @brief get all items, which are set by more than one file of the same include-directory
  *
- * @return false, if item-name and group-name are already registered, else true
+ * @return list of conflicting items with the file of the used value and the overridden file
  */
-bool
-ConfigHandler::registerType(const std::string &groupName,
-                            const std::string &itemName,
-                            const ConfigType type)
+const std::vector<ConfigConflict>
+getConflicts()
 {
-    // precheck if already exist
-    if(isRegistered(groupName, itemName) == true) {
-        return false;
+    if(ConfigHandler::m_config == nullptr) {
+        return std::vector<ConfigConflict>();
     }
 
-    std::map<std::string, std::map<std::string, ConfigType>>::iterator outerIt;
-
-    // add groupName, if not exist
-    outerIt = m_registeredConfigs.find(groupName);
-    if(outerIt == m_registeredConfigs.end())
-    {
-        std::map<std::string, ConfigType> newEntry;
-        m_registeredConfigs.insert(
-                    std::pair<std::string, std::map<std::string, ConfigType>>(groupName, newEntry));
-    }
+    return ConfigHandler::m_config->getConflicts();
+}
 
-    // add new value
-    outerIt = m_registeredConfigs.find(groupName);
-    if(outerIt != m_registeredConfigs.end())
-    {
-        outerIt->second.insert(std::make_pair(itemName, type));
+/**
+ * @brief get the number of reads and the sampled latencies of the getter for each registered item
+ *
+ * @return statistics of all registered items, or empty list, if the library is built without
+ *         instrumentation
+ */
+const std::vector<ConfigAccessStats>
+getConfigAccessStats()
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return std::vector<ConfigAccessStats>();
     }
 
-    return true;
+    return ConfigHandler::m_config->getConfigAccessStats();
 }
 
 /**
- * @brief get registered config-type
+ * @brief get the timings of the initialization and registration of the global config
  *
- * @param groupName name of the group
- * @param itemName name of the item within the group
- *
- * @return undefined-type, if item-name and group-name are not registered, else the registered type
+ * @return timings and counts, which are all zero, if the config is not initialized
  */
-ConfigHandler::ConfigType
-ConfigHandler::getRegisteredType(const std::string &groupName,
-                                 const std::string &itemName)
+const ConfigLoadProfile
+getLoadProfile()
 {
-    std::map<std::string, std::map<std::string, ConfigType>>::const_iterator outerIt;
-    outerIt = m_registeredConfigs.find(groupName);
-
-    if(outerIt != m_registeredConfigs.end())
-    {
-        std::map<std::string, ConfigType>::const_iterator innerIt;
-        innerIt = outerIt->second.find(itemName);
-
-        if(innerIt != outerIt->second.end())
-        {
-            return innerIt->second;
-        }
+    if(ConfigHandler::m_config == nullptr) {
+        return ConfigLoadProfile();
     }
 
-    return UNDEFINED_TYPE;
+    return ConfigHandler::m_config->getLoadProfile();
 }
 
 /**
- * @brief register single value in the config
+ * @brief get the heap-memory of the structures of the global config
+ *
+ * @return memory-usage, which is all zero, if the config is not initialized
+ */
+const ConfigMemoryUsage
+getMemoryUsage()
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return ConfigMemoryUsage();
+    }
+
+    return ConfigHandler::m_config->getMemoryUsage();
+}
+
+/**
+ * @brief subscribe to changes of a single registered item
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param callback function, which is called after a reload, which has changed the value
+ *
+ * @return id of the subscription, or 0 if the item is not registered
+ */
+uint64_t
+subscribe(const std::string &groupName,
+          const std::string &itemName,
+          const ConfigChangeCallback &callback)
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return 0;
+    }
+
+    return ConfigHandler::m_config->subscribe(groupName, itemName, callback);
+}
+
+/**
+ * @brief subscribe to changes of all registered items of a group
+ *
+ * @param groupName name of the group
+ * @param callback function, which is called after a reload, which has changed at least one value
+ *                 of the group
+ *
+ * @return id of the subscription, or 0 if no item of the group is registered
+ */
+uint64_t
+subscribeGroup(const std::string &groupName,
+               const ConfigChangeCallback &callback)
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return 0;
+    }
+
+    return ConfigHandler::m_config->subscribeGroup(groupName, callback);
+}
+
+/**
+ * @brief remove a subscription
+ *
+ * @param subscriptionId id, which was returned by the subscription
+ *
+ * @return false, if the subscription doesn't exist, else true
+ */
+bool
+unsubscribe(const uint64_t subscriptionId)
+{
+    if(ConfigHandler::m_config == nullptr) {
+        return false;
+    }
+
+    return ConfigHandler::m_config->unsubscribe(subscriptionId);
+}
+
+/**
+ * @brief adds the time between its creation and its stop or destruction to a phase of the
+ *        load-profile, so also early returns of a phase are measured
+ */
+class LoadPhaseTimer
+{
+public:
+    LoadPhaseTimer(std::chrono::nanoseconds &phaseTime)
+        : m_phaseTime(phaseTime),
+          m_start(std::chrono::steady_clock::now()) {}
+
+    ~LoadPhaseTimer()
+    {
+        stop();
+    }
+
+    void
+    stop()
+    {
+        if(m_stopped) {
+            return;
+        }
+
+        m_phaseTime += std::chrono::steady_clock::now() - m_start;
+        m_stopped = true;
+    }
+
+private:
+    std::chrono::nanoseconds &m_phaseTime;
+    std::chrono::steady_clock::time_point m_start;
+    bool m_stopped = false;
+};
+
+//==================================================================================================
+
+/**
+ * @brief ConfigHandler::ConfigHandler
+ */
+ConfigHandler::ConfigHandler()
+{
+    m_snapshot.store(new ConfigSnapshot());
+    m_defaults = new ConfigSnapshot();
+    m_registeredConfigs = new ConfigRegistry<ConfigEntry>();
+#ifdef KITSUNEMIMI_CONFIG_ACCESS_STATS
+    m_accessCounters = new ConfigAccessCounters();
+#endif
+}
+
+/**
+ * @brief ConfigHandler::~ConfigHandler
+ */
+ConfigHandler::~ConfigHandler()
+{
+    delete m_sources;
+    delete m_iniItem;
+    delete m_configCache;
+    delete m_accessCounters;
+    delete m_snapshot.load();
+
+    // registered items and defaults of an overlay belong to the base
+    if(m_baseConfig != nullptr)
+    {
+        m_baseConfig->m_numberOfOverlays.fetch_sub(1);
+    }
+    else
+    {
+        delete m_defaults;
+        delete m_registeredConfigs;
+    }
+}
+
+/**
+ * @brief read a ini config-file. If a cache-file is given, which was written for the same content
+ *        of the config-file, the config-file is not parsed at all and the values of all following
+ *        registrations, which are the same like at the time, when the cache was written, are
+ *        taken from the cache without any further check. At the first registration, which
+ *        doesn't match the cache, the config-file is parsed and all registrations are checked
+ *        against it like without cache. The cache is written or updated by sealConfig.
+ *
+ * @param configFilePath absolute path to the config-file to read
+ * @param error reference for error-output
+ * @param cacheFilePath optional path to a precompiled cache of the config-file
+ *
+ * @return false, if reading or parsing the file failed, else true
+ */
+bool
+ConfigHandler::initConfig(const std::string &configFilePath,
+                          ErrorContainer &error,
+                          const std::string &cacheFilePath)
+{
+    ConfigSources sources;
+    sources.addFile(configFilePath);
+    return initConfig(sources, error, cacheFilePath);
+}
+
+/**
+ * @brief read all sources of the config and resolve them once into one set of values, like
+ *        a single config-file. A value of a source with higher precedence replaces the value of
+ *        the same item of all sources with lower precedence. The cache works like for a single
+ *        config-file and is only used, if the content of all sources is the same.
+ *
+ * @param sources config-files and overrides of the config
+ * @param error reference for error-output
+ * @param cacheFilePath optional path to a precompiled cache of the sources
+ *
+ * @return false, if reading or parsing a source failed, else true
+ */
+bool
+ConfigHandler::initConfig(const ConfigSources &sources,
+                          ErrorContainer &error,
+                          const std::string &cacheFilePath)
+{
+    LoadPhaseTimer initTimer(m_loadProfile.initTime);
+
+    delete m_sources;
+    m_sources = new ConfigSources(sources);
+    if(m_sources->filePaths.size() > 0) {
+        m_configFilePath = m_sources->filePaths.front();
+    }
+    readEnvironment();
+
+    // read sources
+    std::vector<SourceContent> contents;
+    LoadPhaseTimer readTimer(m_loadProfile.readTime);
+    const bool readResult = readSources(contents, error);
+    readTimer.stop();
+    if(readResult == false)
+    {
+        LOG_ERROR(error);
+        return false;
+    }
+    countSources(contents);
+
+    hashSources(contents, m_groupHashes);
+
+    // try to use the cache instead of parsing the sources
+    m_cacheFilePath = cacheFilePath;
+    if(m_cacheFilePath.size() > 0)
+    {
+        m_contentHash = hashSourceContents(contents);
+
+        // the variables are only mapped to items at the registration, so all of them belong to
+        // the content of the sources
+        for(const auto& [name, value] : m_environment)
+        {
+            m_contentHash = ConfigCache::hashData(name.c_str(), name.size() + 1, m_contentHash);
+            m_contentHash = ConfigCache::hashData(value.c_str(), value.size() + 1, m_contentHash);
+        }
+
+        // a missing or outdated cache is not an error, it is only rebuilt at the end
+        ErrorContainer cacheError;
+        std::string cacheContent = "";
+        LoadPhaseTimer cacheTimer(m_loadProfile.cacheTime);
+        m_configCache = new ConfigCache();
+        if(readConfigFile(cacheContent, m_cacheFilePath, cacheError)
+                && m_configCache->parseCache(cacheContent, m_contentHash))
+        {
+            m_sourceContents = std::move(contents);
+            m_loadProfile.cacheHit = true;
+            return true;
+        }
+
+        delete m_configCache;
+        m_configCache = nullptr;
+        cacheTimer.stop();
+    }
+
+    // parse sources
+    LoadPhaseTimer parseTimer(m_loadProfile.parseTime);
+    m_iniItem = new IniItem();
+    if(parseSources(contents, nullptr, *m_iniItem, m_valueOrigins, error) == false) {
+        return false;
+    }
+    m_valueOriginsLoaded = true;
+
+    return true;
+}
+
+/**
+ * @brief read a ini config-file as overlay of another config. The overlay uses the registered
+ *        items of the base and holds only the values of the items, which are set in its own
+ *        config-file. All other values are read from the base, so the memory of an overlay
+ *        depends only on the size of its own config-file. Items, which are not registered in the
+ *        base, are ignored. The overlay is sealed immediately and the base can not be reloaded
+ *        anymore, as long as the overlay exists.
+ *
+ * @param baseConfig sealed config, which provides the registered items and the values, which
+ *                   are not overridden
+ * @param configFilePath absolute path to the config-file with the overridden values
+ * @param error reference for error-output
+ *
+ * @return false, if the base is not sealed, this handler was already initialized or the
+ *         config-file is invalid, else true
+ */
+bool
+ConfigHandler::initOverlay(ConfigHandler &baseConfig,
+                           const std::string &configFilePath,
+                           ErrorContainer &error)
+{
+    // check handlers
+    if(baseConfig.m_sealed == false
+            || baseConfig.m_configValid == false)
+    {
+        error.addMeesage("Config overlay failed because base config is not sealed or invalid");
+        LOG_ERROR(error);
+        return false;
+    }
+
+    if(m_sources != nullptr
+            || m_iniItem != nullptr
+            || m_configCache != nullptr
+            || m_baseConfig != nullptr
+            || m_registeredConfigs->size() > 0)
+    {
+        error.addMeesage("Config overlay failed because config is already initialized");
+        LOG_ERROR(error);
+        return false;
+    }
+
+    // read and parse file
+    LoadPhaseTimer initTimer(m_loadProfile.initTime);
+    m_configFilePath = configFilePath;
+    m_sources = new ConfigSources();
+    m_sources->addFile(configFilePath);
+    std::vector<SourceContent> contents;
+    IniItem iniItem;
+    LoadPhaseTimer readTimer(m_loadProfile.readTime);
+    const bool readResult = readSources(contents, error);
+    readTimer.stop();
+    LoadPhaseTimer parseTimer(m_loadProfile.parseTime);
+    if(readResult == false
+            || parseSources(contents, nullptr, iniItem, m_valueOrigins, error) == false)
+    {
+        LOG_ERROR(error);
+        return false;
+    }
+    parseTimer.stop();
+    countSources(contents);
+    m_valueOriginsLoaded = true;
+
+    // the base-snapshot must not change, while the overlay references it
+    std::lock_guard<std::mutex> guard(baseConfig.m_reloadLock);
+
+    delete m_registeredConfigs;
+    delete m_defaults;
+    m_baseConfig = &baseConfig;
+    m_registeredConfigs = baseConfig.m_registeredConfigs;
+    m_defaults = baseConfig.m_defaults;
+    baseConfig.m_numberOfOverlays.fetch_add(1);
+
+    ConfigSnapshot* newSnapshot = buildOverlaySnapshot(iniItem, "Config overlay failed", error);
+    if(newSnapshot == nullptr)
+    {
+        LOG_ERROR(error);
+        m_configValid = false;
+        return false;
+    }
+    newSnapshot->compact();
+
+    delete m_snapshot.exchange(newSnapshot);
+    hashSources(contents, m_groupHashes);
+    m_sealed = true;
+
+    return true;
+}
+
+/**
+ * @brief request if config is valid
+ *
+ * @return true, if valid, else false
+ */
+bool
+ConfigHandler::isConfigValid() const
+{
+    return m_configValid;
+}
+
+/**
+ * @brief finish the registration-phase. The storage of the values is compacted and the parsed
+ *        config-file is deleted, because all registered values are already converted. After this
+ *        no further values can be registered.
+ */
+void
+ConfigHandler::sealConfig()
+{
+    if(m_sealed) {
+        return;
+    }
+
+    LoadPhaseTimer sealTimer(m_loadProfile.sealTime);
+    m_snapshot.load()->compact();
+    m_defaults->compact();
+
+    // write cache for the next start, while it is still known, which values came from the file
+    if(m_cacheFilePath.size() > 0
+            && m_configValid)
+    {
+        writeConfigCache();
+    }
+
+    delete m_configCache;
+    m_configCache = nullptr;
+    m_sourceContents.clear();
+    m_sourceContents.shrink_to_fit();
+
+    delete m_iniItem;
+    m_iniItem = nullptr;
+    m_sealed = true;
+}
+
+/**
+ * @brief seal the config and disable any further reload. The current values are never replaced
+ *        afterwards, so the getter read them directly without registering as reader, which makes
+ *        a handle-getter a single indexed load of the value. A running reload is finished before
+ *        the config is frozen.
+ */
+void
+ConfigHandler::freezeConfig()
+{
+    sealConfig();
+
+    // no reload can run or start, while the lock is held, and every later reload fails
+    std::lock_guard<std::mutex> guard(m_reloadLock);
+    m_frozen.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief register string config value
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param error reference for error-output
+ * @param defaultValue default value, if nothing was set inside of the config
+ * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the type doesn't match or
+ *         item-name and group-name are already registered
+ */
+ConfigKey<std::string>
+ConfigHandler::registerString(const std::string &groupName,
+                              const std::string &itemName,
+                              ErrorContainer &error,
+                              const std::string &defaultValue,
+                              const bool required)
+{
+    LoadPhaseTimer registrationTimer(m_loadProfile.registrationTime);
+    ConfigKey<std::string> key;
+    std::string finalGroupName = groupName;
+    if(registerValue(finalGroupName, itemName, STRING_TYPE, required, error) == false) {
+        return key;
+    }
+
+    // keep default-value for later reloads of the config
+    key.index = m_defaults->appendString(defaultValue);
+
+    // pre-convert value, so the getter doesn't have to touch the parsed config anymore
+    storeValue(finalGroupName, itemName, STRING_TYPE, key.index);
+
+    return key;
+}
+
+/**
+ * @brief register int/long config value
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param error reference for error-output
+ * @param defaultValue default value, if nothing was set inside of the config
+ * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the type doesn't match or
+ *         item-name and group-name are already registered
+ */
+ConfigKey<long>
+ConfigHandler::registerInteger(const std::string &groupName,
+                               const std::string &itemName,
+                               ErrorContainer &error,
+                               const long defaultValue,
+                               const bool required)
+{
+    LoadPhaseTimer registrationTimer(m_loadProfile.registrationTime);
+    ConfigKey<long> key;
+    std::string finalGroupName = groupName;
+    if(registerValue(finalGroupName, itemName, INT_TYPE, required, error) == false) {
+        return key;
+    }
+
+    // keep default-value for later reloads of the config
+    key.index = m_defaults->appendInteger(defaultValue);
+
+    // pre-convert value, so the getter doesn't have to touch the parsed config anymore
+    storeValue(finalGroupName, itemName, INT_TYPE, key.index);
+
+    return key;
+}
+
+/**
+ * @brief register float/double config value
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param error reference for error-output
+ * @param defaultValue default value, if nothing was set inside of the config
+ * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the type doesn't match or
+ *         item-name and group-name are already registered
+ */
+ConfigKey<double>
+ConfigHandler::registerFloat(const std::string &groupName,
+                             const std::string &itemName,
+                             ErrorContainer &error,
+                             const double defaultValue,
+                             const bool required)
+{
+    LoadPhaseTimer registrationTimer(m_loadProfile.registrationTime);
+    ConfigKey<double> key;
+    std::string finalGroupName = groupName;
+    if(registerValue(finalGroupName, itemName, FLOAT_TYPE, required, error) == false) {
+        return key;
+    }
+
+    // keep default-value for later reloads of the config
+    key.index = m_defaults->appendFloat(defaultValue);
+
+    // pre-convert value, so the getter doesn't have to touch the parsed config anymore
+    storeValue(finalGroupName, itemName, FLOAT_TYPE, key.index);
+
+    return key;
+}
+
+/**
+ * @brief register bool config value
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param error reference for error-output
+ * @param defaultValue default value, if nothing was set inside of the config
+ * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the type doesn't match or
+ *         item-name and group-name are already registered
+ */
+ConfigKey<bool>
+ConfigHandler::registerBoolean(const std::string &groupName,
+                               const std::string &itemName,
+                               ErrorContainer &error,
+                               const bool defaultValue,
+                               const bool required)
+{
+    LoadPhaseTimer registrationTimer(m_loadProfile.registrationTime);
+    ConfigKey<bool> key;
+    std::string finalGroupName = groupName;
+    if(registerValue(finalGroupName, itemName, BOOL_TYPE, required, error) == false) {
+        return key;
+    }
+
+    // keep default-value for later reloads of the config
+    key.index = m_defaults->appendBoolean(defaultValue);
+
+    // pre-convert value, so the getter doesn't have to touch the parsed config anymore
+    storeValue(finalGroupName, itemName, BOOL_TYPE, key.index);
+
+    return key;
+}
+
+/**
+ * @brief register string-array config value
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param defaultValue default value, if nothing was set inside of the config
+ * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the type doesn't match or
+ *         item-name and group-name are already registered
+ */
+ConfigKey<std::vector<std::string>>
+ConfigHandler::registerStringArray(const std::string &groupName,
+                                   const std::string &itemName,
+                                   ErrorContainer &error,
+                                   const std::vector<std::string> &defaultValue,
+                                   const bool required)
+{
+    LoadPhaseTimer registrationTimer(m_loadProfile.registrationTime);
+    ConfigKey<std::vector<std::string>> key;
+    std::string finalGroupName = groupName;
+    if(registerValue(finalGroupName, itemName, STRING_ARRAY_TYPE, required, error) == false) {
+        return key;
+    }
+
+    // keep default-value for later reloads of the config
+    key.index = m_defaults->appendStringArray(defaultValue);
+
+    // pre-convert value, so the getter doesn't have to touch the parsed config anymore
+    storeValue(finalGroupName, itemName, STRING_ARRAY_TYPE, key.index);
+
+    return key;
+}
+
+/**
+ * @brief register duration config value. The value in the config-file is an integer with a unit
+ *        like '500ms' or '1h30m', or a plain integer in seconds. It is converted only once here
+ *        and at each reload, so the getter only returns the stored nanoseconds.
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param error reference for error-output
+ * @param defaultValue default value, if nothing was set inside of the config
+ * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the value has no valid unit or
+ *         item-name and group-name are already registered
+ */
+ConfigKey<std::chrono::nanoseconds>
+ConfigHandler::registerDuration(const std::string &groupName,
+                                const std::string &itemName,
+                                ErrorContainer &error,
+                                const std::chrono::nanoseconds defaultValue,
+                                const bool required)
+{
+    LoadPhaseTimer registrationTimer(m_loadProfile.registrationTime);
+    ConfigKey<std::chrono::nanoseconds> key;
+    std::string finalGroupName = groupName;
+    if(registerValue(finalGroupName, itemName, DURATION_TYPE, required, error) == false) {
+        return key;
+    }
+
+    // keep default-value for later reloads of the config
+    key.index = m_defaults->appendInteger(defaultValue.count());
+
+    // pre-convert value, so the getter doesn't have to touch the parsed config anymore
+    storeValue(finalGroupName, itemName, DURATION_TYPE, key.index);
+
+    return key;
+}
+
+/**
+ * @brief register byte-size config value. The value in the config-file is an integer with a unit
+ *        like '64KiB' or '10MB', or a plain integer in bytes. It is converted only once here and
+ *        at each reload, so the getter only returns the stored number of bytes.
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param error reference for error-output
+ * @param defaultValue default value in bytes, if nothing was set inside of the config
+ * @param required if true, then the value must be in the config-file (default: false)
+ *
+ * @return handle to the registered value, which is invalid if the value has no valid unit or
+ *         item-name and group-name are already registered
+ */
+ConfigKey<uint64_t>
+ConfigHandler::registerByteSize(const std::string &groupName,
+                                const std::string &itemName,
+                                ErrorContainer &error,
+                                const uint64_t defaultValue,
+                                const bool required)
+{
+    LoadPhaseTimer registrationTimer(m_loadProfile.registrationTime);
+    ConfigKey<uint64_t> key;
+    std::string finalGroupName = groupName;
+    if(registerValue(finalGroupName, itemName, BYTE_SIZE_TYPE, required, error) == false) {
+        return key;
+    }
+
+    // keep default-value for later reloads of the config
+    key.index = m_defaults->appendInteger(static_cast<long>(defaultValue));
+
+    // pre-convert value, so the getter doesn't have to touch the parsed config anymore
+    storeValue(finalGroupName, itemName, BYTE_SIZE_TYPE, key.index);
+
+    return key;
+}
+
+/**
+ * @brief register a whole schema at once. The items are sorted by their names, so all items of a
+ *        group are processed together and each group of the parsed config-file is only looked up
+ *        once. Failed items are not registered and reported together at the end, all other items
+ *        of the schema are registered nevertheless.
+ *
+ * @param schema list of items to register
+ * @param error reference for error-output
+ *
+ * @return false, if at least one item of the schema failed, else true
+ */
+bool
+ConfigHandler::registerSchema(const std::vector<ConfigSpec> &schema,
+                              ErrorContainer &error)
+{
+    std::vector<uint32_t> indexes;
+    return registerSchema(schema, error, indexes);
+}
+
+/**
+ * @brief register a whole schema at once and get the indexes of the registered items, which can
+ *        be used as handles like ConfigKey<long>{index} for the type of the item
+ *
+ * @param schema list of items to register
+ * @param error reference for error-output
+ * @param indexes reference for the indexes of the items in order of the schema, which are
+ *                UNREGISTERED_CONFIG_KEY for failed items
+ *
+ * @return false, if at least one item of the schema failed, else true
+ */
+bool
+ConfigHandler::registerSchema(const std::vector<ConfigSpec> &schema,
+                              ErrorContainer &error,
+                              std::vector<uint32_t> &indexes)
+{
+    indexes.assign(schema.size(), UNREGISTERED_CONFIG_KEY);
+
+    // check if registration-phase is already finished
+    if(m_sealed)
+    {
+        error.addMeesage("Config registration of schema failed because config is already sealed");
+        LOG_ERROR(error);
+        m_configValid = false;
+        return false;
+    }
+
+    // sort items by group- and item-name
+    std::vector<const ConfigSpec*> sortedSchema;
+    sortedSchema.reserve(schema.size());
+    for(const ConfigSpec &spec : schema) {
+        sortedSchema.push_back(&spec);
+    }
+    std::stable_sort(sortedSchema.begin(),
+                     sortedSchema.end(),
+                     [](const ConfigSpec* a, const ConfigSpec* b) {
+                         return std::tie(a->groupName, a->itemName)
+                                < std::tie(b->groupName, b->itemName);
+                     });
+
+    bool result = true;
+
+    // the cache can only be checked with single registrations
+    if(m_configCache != nullptr)
+    {
+        for(const ConfigSpec* spec : sortedSchema)
+        {
+            const uint32_t index = registerSpec(*spec, error);
+            indexes[spec - schema.data()] = index;
+            if(index == UNREGISTERED_CONFIG_KEY) {
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    LoadPhaseTimer registrationTimer(m_loadProfile.registrationTime);
+    m_loadProfile.numberOfRegistrations += schema.size();
+    m_registeredConfigs->reserve(m_registeredConfigs->size() + schema.size());
+
+    const std::string defaultGroupName = "DEFAULT";
+
+    // merge the values of the environment before the groups are looked up. Items with a broken
+    // value in the environment are skipped later, like in the single registration.
+    std::vector<bool> environmentFailed(sortedSchema.size(), false);
+    for(uint64_t i = 0; i < sortedSchema.size(); i++)
+    {
+        const ConfigSpec* spec = sortedSchema[i];
+        const std::string &groupName = spec->groupName.size() == 0 ? defaultGroupName
+                                                                   : spec->groupName;
+        if(isRegistered(groupName, spec->itemName) == false
+                && applyEnvironment(groupName, spec->itemName, error) == false)
+        {
+            addRegistrationError(error, "of the environment", groupName, spec->itemName, false);
+            environmentFailed[i] = true;
+            result = false;
+        }
+    }
+
+    const std::string* currentGroupName = nullptr;
+    DataMap* currentGroup = nullptr;
+
+    for(uint64_t i = 0; i < sortedSchema.size(); i++)
+    {
+        if(environmentFailed[i]) {
+            continue;
+        }
+
+        const ConfigSpec* spec = sortedSchema[i];
+        // if group-name is empty, then use the default-group
+        const std::string &groupName = spec->groupName.size() == 0 ? defaultGroupName
+                                                                   : spec->groupName;
+        const std::string &itemName = spec->itemName;
+
+        // look up group within the parsed config-file only at the first item of the group
+        if(currentGroupName == nullptr
+                || *currentGroupName != groupName)
+        {
+            currentGroupName = &groupName;
+            DataItem* groupItem = m_iniItem->m_content->get(groupName);
+            currentGroup = nullptr;
+            if(groupItem != nullptr) {
+                currentGroup = groupItem->toMap();
+            }
+        }
+
+        DataItem* value = nullptr;
+        if(currentGroup != nullptr) {
+            value = currentGroup->get(itemName);
+        }
+
+        // check item and register it
+        LoadPhaseTimer checkTypeTimer(m_loadProfile.checkTypeTime);
+        const bool typeMatches = spec->type != UNDEFINED_TYPE
+                                 && checkItemType(value, spec->type);
+        checkTypeTimer.stop();
+        if(typeMatches == false)
+        {
+            addRegistrationError(error,
+                                 "item has the false value type",
+                                 groupName,
+                                 itemName,
+                                 false);
+            result = false;
+            continue;
+        }
+
+        if(spec->required
+                && value == nullptr)
+        {
+            addRegistrationError(error,
+                                 "required value was not set in the config",
+                                 groupName,
+                                 itemName,
+                                 false);
+            result = false;
+            continue;
+        }
+
+        LoadPhaseTimer registerTypeTimer(m_loadProfile.registerTypeTime);
+        const bool inserted = registerType(groupName, itemName, spec->type, spec->required);
+        registerTypeTimer.stop();
+        if(inserted == false)
+        {
+            addRegistrationError(error, "item is already registered", groupName, itemName, false);
+            result = false;
+            continue;
+        }
+
+        const uint32_t index = appendDefault(*spec);
+        appendValue(m_snapshot.load(), value, spec->type, index);
+        indexes[spec - schema.data()] = index;
+    }
+
+    if(result == false)
+    {
+        LoadPhaseTimer errorTimer(m_loadProfile.errorFormattingTime);
+        LOG_ERROR(error);
+        m_configValid = false;
+    }
+
+    return result;
+}
+
+/**
+ * @brief get string-value from config
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return empty string, if item-name and group-name are not registered, else value from the
+ *         config-file or the defined default-value.
+ */
+const std::string
+ConfigHandler::getString(std::string_view groupName,
+                         std::string_view itemName,
+                         bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    success = true;
+
+    // compare with registered type
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr
+            || entry->type != ConfigType::STRING_TYPE)
+    {
+        success = false;
+        return "";
+    }
+
+    SET_CONFIG_ACCESS_KEY(entry->type, entry->index);
+    // get pre-converted value
+    SnapshotReader reader(this);
+    return reader.snapshot->getString(entry->index);
+}
+
+/**
+ * @brief get long-value from config
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return 0, if item-name and group-name are not registered, else value from the
+ *         config-file or the defined default-value.
+ */
+long
+ConfigHandler::getInteger(std::string_view groupName,
+                          std::string_view itemName,
+                          bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    success = true;
+
+    // compare with registered type
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr
+            || entry->type != ConfigType::INT_TYPE)
+    {
+        success = false;
+        return 0l;
+    }
+
+    SET_CONFIG_ACCESS_KEY(entry->type, entry->index);
+    // get pre-converted value
+    SnapshotReader reader(this);
+    return reader.snapshot->getInteger(entry->index);
+}
+
+/**
+ * @brief get double-value from config
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return 0.0, if item-name and group-name are not registered, else value from the
+ *         config-file or the defined default-value.
+ */
+double
+ConfigHandler::getFloat(std::string_view groupName,
+                        std::string_view itemName,
+                        bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    success = true;
+
+    // compare with registered type
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr
+            || entry->type != ConfigType::FLOAT_TYPE)
+    {
+        success = false;
+        return 0.0;
+    }
+
+    SET_CONFIG_ACCESS_KEY(entry->type, entry->index);
+    // get pre-converted value
+    SnapshotReader reader(this);
+    return reader.snapshot->getFloat(entry->index);
+}
+
+/**
+ * @brief get bool-value from config
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return false, if item-name and group-name are not registered, else value from the
+ *         config-file or the defined default-value.
+ */
+bool
+ConfigHandler::getBoolean(std::string_view groupName,
+                          std::string_view itemName,
+                          bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    success = true;
+
+    // compare with registered type
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr
+            || entry->type != ConfigType::BOOL_TYPE)
+    {
+        success = false;
+        return false;
+    }
+
+    SET_CONFIG_ACCESS_KEY(entry->type, entry->index);
+    // get pre-converted value
+    SnapshotReader reader(this);
+    return reader.snapshot->getBoolean(entry->index);
+}
+
+/**
+ * @brief get string-array-value from config
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return empty string-array, if item-name and group-name are not registered, else value from the
+ *         config-file or the defined default-value.
+ */
+const std::vector<std::string>
+ConfigHandler::getStringArray(std::string_view groupName,
+                              std::string_view itemName,
+                              bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    success = true;
+
+    // compare with registered type
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr
+            || entry->type != ConfigType::STRING_ARRAY_TYPE)
+    {
+        success = false;
+        return std::vector<std::string>();
+    }
+
+    SET_CONFIG_ACCESS_KEY(entry->type, entry->index);
+    // get pre-converted value
+    SnapshotReader reader(this);
+    return reader.snapshot->getStringArray(entry->index);
+}
+
+/**
+ * @brief get duration-value from config
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return 0, if item-name and group-name are not registered, else value from the
+ *         config-file or the defined default-value.
+ */
+std::chrono::nanoseconds
+ConfigHandler::getDuration(std::string_view groupName,
+                           std::string_view itemName,
+                           bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    success = true;
+
+    // compare with registered type
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr
+            || entry->type != ConfigType::DURATION_TYPE)
+    {
+        success = false;
+        return std::chrono::nanoseconds(0);
+    }
+
+    SET_CONFIG_ACCESS_KEY(entry->type, entry->index);
+    // get pre-converted value
+    SnapshotReader reader(this);
+    return std::chrono::nanoseconds(reader.snapshot->getInteger(entry->index));
+}
+
+/**
+ * @brief get byte-size-value from config
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return 0, if item-name and group-name are not registered, else value in bytes from the
+ *         config-file or the defined default-value.
+ */
+uint64_t
+ConfigHandler::getByteSize(std::string_view groupName,
+                           std::string_view itemName,
+                           bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    success = true;
+
+    // compare with registered type
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr
+            || entry->type != ConfigType::BYTE_SIZE_TYPE)
+    {
+        success = false;
+        return 0;
+    }
+
+    SET_CONFIG_ACCESS_KEY(entry->type, entry->index);
+    // get pre-converted value
+    SnapshotReader reader(this);
+    return static_cast<uint64_t>(reader.snapshot->getInteger(entry->index));
+}
+
+/**
+ * @brief get string-value from config by its handle
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return empty string, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
+ */
+const std::string
+ConfigHandler::getString(const ConfigKey<std::string> &key,
+                         bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    SnapshotReader reader(this);
+    success = key.index < reader.snapshot->numberOfStrings();
+    if(success == false) {
+        return "";
+    }
+    SET_CONFIG_ACCESS_KEY(STRING_TYPE, key.index);
+
+    return reader.snapshot->getString(key.index);
+}
+
+/**
+ * @brief get long-value from config by its handle
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return 0, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
+ */
+long
+ConfigHandler::getInteger(const ConfigKey<long> &key,
+                          bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    SnapshotReader reader(this);
+    success = key.index < reader.snapshot->numberOfIntegers();
+    if(success == false) {
+        return 0l;
+    }
+    SET_CONFIG_ACCESS_KEY(INT_TYPE, key.index);
+
+    return reader.snapshot->getInteger(key.index);
+}
+
+/**
+ * @brief get double-value from config by its handle
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return 0.0, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
+ */
+double
+ConfigHandler::getFloat(const ConfigKey<double> &key,
+                        bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    SnapshotReader reader(this);
+    success = key.index < reader.snapshot->numberOfFloats();
+    if(success == false) {
+        return 0.0;
+    }
+    SET_CONFIG_ACCESS_KEY(FLOAT_TYPE, key.index);
+
+    return reader.snapshot->getFloat(key.index);
+}
+
+/**
+ * @brief get bool-value from config by its handle
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return false, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
+ */
+bool
+ConfigHandler::getBoolean(const ConfigKey<bool> &key,
+                          bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    SnapshotReader reader(this);
+    success = key.index < reader.snapshot->numberOfBooleans();
+    if(success == false) {
+        return false;
+    }
+    SET_CONFIG_ACCESS_KEY(BOOL_TYPE, key.index);
+
+    return reader.snapshot->getBoolean(key.index);
+}
+
+/**
+ * @brief get string-array-value from config by its handle
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return empty string-array, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
+ */
+const std::vector<std::string>
+ConfigHandler::getStringArray(const ConfigKey<std::vector<std::string>> &key,
+                              bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    SnapshotReader reader(this);
+    success = key.index < reader.snapshot->numberOfStringArrays();
+    if(success == false) {
+        return std::vector<std::string>();
+    }
+    SET_CONFIG_ACCESS_KEY(STRING_ARRAY_TYPE, key.index);
+
+    return reader.snapshot->getStringArray(key.index);
+}
+
+/**
+ * @brief get duration-value from config by its handle
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return 0, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
+ */
+std::chrono::nanoseconds
+ConfigHandler::getDuration(const ConfigKey<std::chrono::nanoseconds> &key,
+                           bool &success)
+{
+    SnapshotReader reader(this);
+    return reader.getDuration(key, success);
+}
+
+/**
+ * @brief get byte-size-value from config by its handle
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return 0, if the handle is invalid, else value in bytes from the config-file or the
+ *         defined default-value.
+ */
+uint64_t
+ConfigHandler::getByteSize(const ConfigKey<uint64_t> &key,
+                           bool &success)
+{
+    SnapshotReader reader(this);
+    return reader.getByteSize(key, success);
+}
+
+/**
+ * @brief get string-value from config without copy
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return empty view, if item-name and group-name are not registered or the config is not sealed
+ *         yet, else view on the value. The view is valid until the next reload of the config.
+ */
+std::string_view
+ConfigHandler::getStringView(std::string_view groupName,
+                             std::string_view itemName,
+                             bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    success = true;
+
+    // compare with registered type
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr
+            || entry->type != ConfigType::STRING_TYPE
+            || m_sealed == false)
+    {
+        success = false;
+        return std::string_view();
+    }
+
+    SET_CONFIG_ACCESS_KEY(entry->type, entry->index);
+    // get view on the value
+    SnapshotReader reader(this);
+    return reader.snapshot->getStringView(entry->index);
+}
+
+/**
+ * @brief get string-value from config by its handle without copy
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return empty view, if the handle is invalid or the config is not sealed yet, else view on the
+ *         value. The view is valid until the next reload of the config.
+ */
+std::string_view
+ConfigHandler::getStringView(const ConfigKey<std::string> &key,
+                             bool &success)
+{
+    SnapshotReader reader(this);
+    return reader.getStringView(key, success);
+}
+
+/**
+ * @brief get string-array-value from config without copy
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param success reference to bool-value with the result. returns false if item-name and group-name
+ *                are not registered, else true.
+ *
+ * @return empty view, if item-name and group-name are not registered or the config is not sealed
+ *         yet, else view on the value. The view is valid until the next reload of the config.
+ */
+StringArrayView
+ConfigHandler::getStringArrayView(std::string_view groupName,
+                                  std::string_view itemName,
+                                  bool &success)
+{
+    RECORD_CONFIG_ACCESS(getAccessCounters());
+    success = true;
+
+    // compare with registered type
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr
+            || entry->type != ConfigType::STRING_ARRAY_TYPE
+            || m_sealed == false)
+    {
+        success = false;
+        return StringArrayView();
+    }
+
+    SET_CONFIG_ACCESS_KEY(entry->type, entry->index);
+    // get view on the value
+    SnapshotReader reader(this);
+    return reader.snapshot->getStringArrayView(entry->index);
+}
+
+/**
+ * @brief get string-array-value from config by its handle without copy
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return empty view, if the handle is invalid or the config is not sealed yet, else view on the
+ *         value. The view is valid until the next reload of the config.
+ */
+StringArrayView
+ConfigHandler::getStringArrayView(const ConfigKey<std::vector<std::string>> &key,
+                                  bool &success)
+{
+    SnapshotReader reader(this);
+    return reader.getStringArrayView(key, success);
+}
+
+/**
+ * @brief get the source of the current value of a registered item. This is not meant for the
+ *        hot path, because it takes the lock of the reload. The value of an overlay, which is not
+ *        overridden by the overlay, has the source of the value within the base.
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param origin reference for the file-path or the origin of the override, which has set the value
+ *
+ * @return UNDEFINED_SOURCE, if the item is not registered, else source of the value
+ */
+ConfigHandler::ConfigSource
+ConfigHandler::getValueSource(const std::string &groupName,
+                              const std::string &itemName,
+                              std::string &origin)
+{
+    origin = "";
+    if(isRegistered(groupName, itemName) == false) {
+        return UNDEFINED_SOURCE;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_reloadLock);
+
+        if(m_valueOriginsLoaded == false
+                && loadValueOrigins() == false)
+        {
+            return UNDEFINED_SOURCE;
+        }
+
+        const auto group = m_valueOrigins.find(groupName);
+        if(group != m_valueOrigins.end())
+        {
+            const auto item = group->second.find(itemName);
+            if(item != group->second.end())
+            {
+                origin = item->second.origin;
+                return item->second.source;
+            }
+        }
+    }
+
+    if(m_baseConfig != nullptr) {
+        return m_baseConfig->getValueSource(groupName, itemName, origin);
+    }
+
+    return DEFAULT_SOURCE;
+}
+
+/**
+ * @brief get all items, which are set by more than one file of the same include-directory
+ *
+ * @return list of conflicting items with the file of the used value and the overridden file
+ */
+const std::vector<ConfigConflict>
+ConfigHandler::getConflicts()
+{
+    std::vector<ConfigConflict> conflicts;
+    std::lock_guard<std::mutex> guard(m_reloadLock);
+
+    if(m_valueOriginsLoaded == false
+            && loadValueOrigins() == false)
+    {
+        return conflicts;
+    }
+
+    for(const auto& [groupName, items] : m_valueOrigins)
+    {
+        for(const auto& [itemName, origin] : items)
+        {
+            if(origin.conflict.size() == 0) {
+                continue;
+            }
+
+            ConfigConflict conflict;
+            conflict.groupName = groupName;
+            conflict.itemName = itemName;
+            conflict.origin = origin.origin;
+            conflict.overriddenOrigin = origin.conflict;
+            conflicts.push_back(conflict);
+        }
+    }
+
+    return conflicts;
+}
+
+/**
+ * @brief get the number of reads and the sampled latencies of the getter for each registered
+ *        item. The counters are read while other threads are still counting, so the result is
+ *        not an exact state of a single point in time.
+ *
+ * @return statistics of all registered items in order of their registration, or empty list, if
+ *         the library is built without instrumentation
+ */
+const std::vector<ConfigAccessStats>
+ConfigHandler::getConfigAccessStats()
+{
+    std::vector<ConfigAccessStats> result;
+    const ConfigAccessCounters* counters = getAccessCounters();
+    if(counters == nullptr) {
+        return result;
+    }
+
+    result.reserve(m_registeredConfigs->size());
+    for(const ConfigRegistry<ConfigEntry>::Item &item : *m_registeredConfigs)
+    {
+        const ConfigEntry &entry = item.value;
+
+        ConfigAccessStats stats;
+        stats.groupName = m_registeredConfigs->getName(item.groupId);
+        stats.itemName = m_registeredConfigs->getName(item.itemId);
+        stats.type = entry.type;
+        stats.numberOfReads = counters->getNumberOfReads(entry.type, entry.index);
+        stats.latencyHistogram = counters->getLatencyHistogram(entry.type, entry.index);
+        for(const uint64_t numberOfSamples : stats.latencyHistogram) {
+            stats.numberOfSamples += numberOfSamples;
+        }
+        result.push_back(stats);
+    }
+
+    return result;
+}
+
+/**
+ * @brief get the timings and counts of the initialization and registration of this config
+ *
+ * @return copy of the current load-profile
+ */
+const ConfigLoadProfile
+ConfigHandler::getLoadProfile() const
+{
+    return m_loadProfile;
+}
+
+/**
+ * @brief estimate the heap-memory of a parsed item and all of its child-items. The strings of
+ *        parsed values are counted with their length, because the parser stores each of them in
+ *        its own buffer.
+ *
+ * @param item parsed item
+ *
+ * @return number of allocated bytes
+ */
+static uint64_t
+getDataItemSize(DataItem* item)
+{
+    if(item == nullptr) {
+        return 0;
+    }
+
+    DataMap* map = item->toMap();
+    if(map != nullptr)
+    {
+        uint64_t size = sizeof(DataMap) + getNodeSize(map->m_map);
+        for(const auto& [name, child] : map->m_map) {
+            size += getHeapSize(name) + getDataItemSize(child);
+        }
+        return size;
+    }
+
+    DataArray* array = item->toArray();
+    if(array != nullptr)
+    {
+        uint64_t size = sizeof(DataArray) + array->size() * sizeof(DataItem*);
+        for(uint64_t i = 0; i < array->size(); i++) {
+            size += getDataItemSize(array->get(i));
+        }
+        return size;
+    }
+
+    uint64_t size = sizeof(DataValue);
+    DataValue* value = item->toValue();
+    if(value != nullptr
+            && value->getValueType() == DataValue::STRING_TYPE)
+    {
+        size += value->getString().size() + 1;
+    }
+
+    return size;
+}
+
+/**
+ * @brief get the heap-memory of the hashes of the groups of a config-file
+ *
+ * @param groupHashes hashes of the groups
+ *
+ * @return number of allocated bytes
+ */
+static uint64_t
+getGroupHashesSize(const std::map<std::string, uint64_t> &groupHashes)
+{
+    uint64_t size = getNodeSize(groupHashes);
+    for(const auto& [groupName, hash] : groupHashes) {
+        size += getHeapSize(groupName);
+    }
+
+    return size;
+}
+
+/**
+ * @brief get the heap-memory of the structures of this config. It must not be called by the
+ *        callback of a subscription, because it waits for a running reload.
+ *
+ * @return memory-usage in bytes per structure
+ */
+const ConfigMemoryUsage
+ConfigHandler::getMemoryUsage()
+{
+    // a reload replaces the values, the content of the sources and the origins
+    std::lock_guard<std::mutex> guard(m_reloadLock);
+
+    ConfigMemoryUsage usage;
+    if(m_iniItem != nullptr) {
+        usage.parsedTree = sizeof(IniItem) + getDataItemSize(m_iniItem->m_content);
+    }
+
+    // registered items and defaults of an overlay belong to the base
+    if(m_baseConfig == nullptr)
+    {
+        usage.registry = sizeof(ConfigRegistry<ConfigEntry>)
+                         + m_registeredConfigs->getMemoryUsage()
+                         + getNodeSize(m_environmentNames);
+        for(const auto& [name, item] : m_environmentNames)
+        {
+            usage.registry += getHeapSize(name)
+                              + getHeapSize(item.first)
+                              + getHeapSize(item.second);
+        }
+        usage.defaults = sizeof(ConfigSnapshot) + m_defaults->getMemoryUsage();
+    }
+
+    const ConfigSnapshot* snapshot = m_snapshot.load();
+    usage.stringPayloads = snapshot->getPayloadSize();
+    usage.values = sizeof(ConfigSnapshot) + snapshot->getMemoryUsage() - usage.stringPayloads;
+
+    // content of the sources
+    usage.sources = getNodeSize(m_fragments)
+                    + getGroupHashesSize(m_groupHashes)
+                    + getHeapSize(m_sourceContents);
+    for(const auto& [filePath, fragment] : m_fragments)
+    {
+        usage.sources += getHeapSize(filePath)
+                         + getHeapSize(fragment.content)
+                         + getHeapSize(fragment.includes)
+                         + getGroupHashesSize(fragment.groupHashes);
+        for(const auto& [directive, value] : fragment.includes) {
+            usage.sources += getHeapSize(directive) + getHeapSize(value);
+        }
+    }
+    for(const SourceContent &sourceContent : m_sourceContents)
+    {
+        usage.sources += getHeapSize(sourceContent.origin)
+                         + getHeapSize(sourceContent.content)
+                         + getHeapSize(sourceContent.includeDirectory)
+                         + getGroupHashesSize(sourceContent.groupHashes);
+    }
+
+    // origins of the values
+    usage.origins = getNodeSize(m_valueOrigins);
+    for(const auto& [groupName, items] : m_valueOrigins)
+    {
+        usage.origins += getHeapSize(groupName) + getNodeSize(items);
+        for(const auto& [itemName, origin] : items)
+        {
+            usage.origins += getHeapSize(itemName)
+                             + getHeapSize(origin.origin)
+                             + getHeapSize(origin.includeDirectory)
+                             + getHeapSize(origin.conflict);
+        }
+    }
+
+    usage.total = usage.parsedTree
+                  + usage.registry
+                  + usage.values
+                  + usage.stringPayloads
+                  + usage.defaults
+                  + usage.sources
+                  + usage.origins;
+
+    return usage;
+}
+
+/**
+ * @brief subscribe to changes of a single registered item. The callback is called by the thread,
+ *        which runs the reload, after the new values are published and the reload-lock is
+ *        released. It must not call reloadConfig.
+ *
+ * @param groupName name of the group, or empty string for the default-group
+ * @param itemName name of the item within the group
+ * @param callback function, which is called after a reload, which has changed the value
+ *
+ * @return id of the subscription, or 0 if the item is not registered
+ */
+uint64_t
+ConfigHandler::subscribe(const std::string &groupName,
+                         const std::string &itemName,
+                         const ConfigChangeCallback &callback)
+{
+    // if group-name is empty, then use the default-group like the registration
+    const std::string finalGroupName = groupName.size() == 0 ? "DEFAULT" : groupName;
+
+    if(isRegistered(finalGroupName, itemName) == false)
+    {
+        ErrorContainer error;
+        error.addMeesage("Config subscription failed because item is not registered: \n"
+                         "    group: \'" + finalGroupName + "\'\n"
+                         "    item: \'" + itemName + "\'");
+        LOG_ERROR(error);
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> guard(m_subscriptionLock);
+
+    Subscription subscription;
+    subscription.id = m_nextSubscriptionId++;
+    subscription.groupName = finalGroupName;
+    subscription.itemName = itemName;
+    subscription.callback = callback;
+    m_subscriptions.push_back(subscription);
+
+    return subscription.id;
+}
+
+/**
+ * @brief subscribe to changes of all registered items of a group. The callback is called once per
+ *        reload with all changed items of the group.
+ *
+ * @param groupName name of the group, or empty string for the default-group
+ * @param callback function, which is called after a reload, which has changed at least one value
+ *                 of the group
+ *
+ * @return id of the subscription, or 0 if no item of the group is registered
+ */
+uint64_t
+ConfigHandler::subscribeGroup(const std::string &groupName,
+                              const ConfigChangeCallback &callback)
+{
+    // if group-name is empty, then use the default-group like the registration
+    const std::string finalGroupName = groupName.size() == 0 ? "DEFAULT" : groupName;
+
+    bool groupRegistered = false;
+    const uint32_t groupId = m_registeredConfigs->getNameId(finalGroupName);
+    if(groupId != UNKNOWN_CONFIG_NAME)
+    {
+        for(const ConfigRegistry<ConfigEntry>::Item &item : *m_registeredConfigs)
+        {
+            if(item.groupId == groupId)
+            {
+                groupRegistered = true;
+                break;
+            }
+        }
+    }
+
+    if(groupRegistered == false)
+    {
+        ErrorContainer error;
+        error.addMeesage("Config subscription failed because group has no registered item: \n"
+                         "    group: \'" + finalGroupName + "\'");
+        LOG_ERROR(error);
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> guard(m_subscriptionLock);
+
+    Subscription subscription;
+    subscription.id = m_nextSubscriptionId++;
+    subscription.groupName = finalGroupName;
+    subscription.wholeGroup = true;
+    subscription.callback = callback;
+    m_subscriptions.push_back(subscription);
+
+    return subscription.id;
+}
+
+/**
+ * @brief remove a subscription. A callback, which is already running, is not interrupted.
+ *
+ * @param subscriptionId id, which was returned by the subscription
+ *
+ * @return false, if the subscription doesn't exist, else true
+ */
+bool
+ConfigHandler::unsubscribe(const uint64_t subscriptionId)
+{
+    std::lock_guard<std::mutex> guard(m_subscriptionLock);
+
+    for(uint64_t i = 0; i < m_subscriptions.size(); i++)
+    {
+        if(m_subscriptions[i].id == subscriptionId)
+        {
+            m_subscriptions.erase(m_subscriptions.begin() + i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief append the default-value of an item of a schema to the defaults
+ *
+ * @param spec item of the schema
+ *
+ * @return index of the default-value
+ */
+uint32_t
+ConfigHandler::appendDefault(const ConfigSpec &spec)
+{
+    switch(spec.type)
+    {
+        case STRING_TYPE:       return m_defaults->appendString(spec.stringDefault);
+        case INT_TYPE:          return m_defaults->appendInteger(spec.intDefault);
+        case FLOAT_TYPE:        return m_defaults->appendFloat(spec.floatDefault);
+        case BOOL_TYPE:         return m_defaults->appendBoolean(spec.boolDefault);
+        case STRING_ARRAY_TYPE: return m_defaults->appendStringArray(spec.stringArrayDefault);
+        case DURATION_TYPE:     return m_defaults->appendInteger(spec.durationDefault.count());
+        case BYTE_SIZE_TYPE:    return m_defaults->appendInteger(
+                                        static_cast<long>(spec.byteSizeDefault));
+        case UNDEFINED_TYPE:    break;
+    }
+
+    return UNREGISTERED_CONFIG_KEY;
+}
+
+/**
+ * @brief register a single item of a schema with the register-function of its type
+ *
+ * @param spec item of the schema
+ * @param error reference for error-output
+ *
+ * @return UNREGISTERED_CONFIG_KEY, if registration failed, else index of the item
+ */
+uint32_t
+ConfigHandler::registerSpec(const ConfigSpec &spec,
+                            ErrorContainer &error)
+{
+    const std::string &groupName = spec.groupName;
+    const std::string &itemName = spec.itemName;
+    const bool required = spec.required;
+
+    switch(spec.type)
+    {
+        case STRING_TYPE:
+            return registerString(groupName,
+                                  itemName,
+                                  error,
+                                  spec.stringDefault,
+                                  required).index;
+        case INT_TYPE:
+            return registerInteger(groupName,
+                                   itemName,
+                                   error,
+                                   spec.intDefault,
+                                   required).index;
+        case FLOAT_TYPE:
+            return registerFloat(groupName,
+                                 itemName,
+                                 error,
+                                 spec.floatDefault,
+                                 required).index;
+        case BOOL_TYPE:
+            return registerBoolean(groupName,
+                                   itemName,
+                                   error,
+                                   spec.boolDefault,
+                                   required).index;
+        case STRING_ARRAY_TYPE:
+            return registerStringArray(groupName,
+                                       itemName,
+                                       error,
+                                       spec.stringArrayDefault,
+                                       required).index;
+        case DURATION_TYPE:
+            return registerDuration(groupName,
+                                    itemName,
+                                    error,
+                                    spec.durationDefault,
+                                    required).index;
+        case BYTE_SIZE_TYPE:
+            return registerByteSize(groupName,
+                                    itemName,
+                                    error,
+                                    spec.byteSizeDefault,
+                                    required).index;
+        case UNDEFINED_TYPE:
+            break;
+    }
+
+    m_loadProfile.numberOfRegistrations++;
+    addRegistrationError(error, "item has no type", groupName, itemName);
+    return UNREGISTERED_CONFIG_KEY;
+}
+
+/**
+ * @brief convert the value of a new registered item and append it to the current snapshot
+ *
+ * @param groupName group-name of the item
+ * @param itemName item-name of the item
+ * @param type type of the item
+ * @param index index of the value of the item
+ */
+void
+ConfigHandler::storeValue(const std::string &groupName,
+                          const std::string &itemName,
+                          const ConfigType type,
+                          const uint32_t index)
+{
+    if(m_configCache != nullptr) {
+        m_configCache->appendValue(m_snapshot.load(), m_defaults, type, index);
+    }
+    else {
+        appendValue(m_snapshot.load(), m_iniItem->get(groupName, itemName), type, index);
+    }
+}
+
+/**
+ * @brief convert the values of a parsed config-file of an overlay into a layer on top of the
+ *        values of the base
+ *
+ * @param iniItem parsed config-file
+ * @param operation name of the operation for the error-messages
+ * @param error reference for error-output
+ *
+ * @return new snapshot with the overridden values, or nullptr, if a value doesn't match the type
+ *         of its registered item
+ */
+ConfigSnapshot*
+ConfigHandler::buildOverlaySnapshot(IniItem &iniItem,
+                                    const std::string &operation,
+                                    ErrorContainer &error)
+{
+    // collect all overridden items ordered by the type of their value-list and index
+    std::vector<std::vector<std::tuple<uint32_t, ConfigType, DataItem*>>> values(
+            STRING_ARRAY_TYPE + 1);
+    bool valid = true;
+
+    for(const auto& [groupName, group] : iniItem.m_content->m_map)
+    {
+        DataMap* groupMap = group->toMap();
+        if(groupMap == nullptr) {
+            continue;
+        }
+
+        for(const auto& [itemName, value] : groupMap->m_map)
+        {
+            // like in the base, items which are not registered are ignored
+            const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+            if(entry == nullptr) {
+                continue;
+            }
+
+            if(checkItemType(value, entry->type) == false)
+            {
+                error.addMeesage(operation + " because item has the false value type: \n"
+                                 "    group: \'" + groupName + "\'\n"
+                                 "    item: \'" + itemName + "\'");
+                valid = false;
+                continue;
+            }
+
+            values[getStorageType(entry->type)].emplace_back(entry->index, entry->type, value);
+        }
+    }
+
+    if(valid == false) {
+        return nullptr;
+    }
+
+    // build new layer
+    ConfigSnapshot* newSnapshot = new ConfigSnapshot();
+    newSnapshot->setBase(m_baseConfig->m_snapshot.load());
+    for(uint32_t type = STRING_TYPE; type <= STRING_ARRAY_TYPE; type++)
+    {
+        const ConfigType storageType = static_cast<ConfigType>(type);
+        std::sort(values[type].begin(), values[type].end());
+        for(const auto& [index, configType, value] : values[type])
+        {
+            newSnapshot->addOverride(storageType, index);
+            appendValue(newSnapshot, value, configType, index);
+        }
+    }
+
+    return newSnapshot;
+}
+
+/**
+ * @brief validate a parsed config-file against all registered items and convert their values
+ *
+ * @param iniItem parsed config-file
+ * @param operation name of the operation for the error-messages
+ * @param error reference for error-output
+ * @param oldSnapshot optional current values, which are used for all items, whose group was not
+ *                    changed
+ * @param changedGroups optional names of the groups, which were parsed into the iniItem. Only
+ *                      used together with the old snapshot.
+ *
+ * @return new snapshot with the values of all registered items, or nullptr, if the config-file
+ *         doesn't match the registered items
+ */
+ConfigSnapshot*
+ConfigHandler::buildSnapshot(IniItem &iniItem,
+                             const std::string &operation,
+                             ErrorContainer &error,
+                             const ConfigSnapshot* oldSnapshot,
+                             const std::set<std::string>* changedGroups)
+{
+    // collect all registered items ordered by the type of their value-list and index, because
+    // the values have to be appended to the new snapshot in the same order like at the
+    // registration. Values with a unit share the list of the integers.
+    std::vector<std::vector<std::pair<DataItem*, ConfigType>>> values(STRING_ARRAY_TYPE + 1);
+    values[STRING_TYPE].resize(m_defaults->numberOfStrings());
+    values[INT_TYPE].resize(m_defaults->numberOfIntegers());
+    values[FLOAT_TYPE].resize(m_defaults->numberOfFloats());
+    values[BOOL_TYPE].resize(m_defaults->numberOfBooleans());
+    values[STRING_ARRAY_TYPE].resize(m_defaults->numberOfStringArrays());
+
+    // values of unchanged groups are copied from the old snapshot
+    std::vector<std::vector<bool>> unchanged(STRING_ARRAY_TYPE + 1);
+    for(uint32_t type = STRING_TYPE; type <= STRING_ARRAY_TYPE; type++) {
+        unchanged[type].resize(values[type].size(), false);
+    }
+
+    // mark the changed groups by the ids of their names, so the items don't have to be
+    // checked by their group-names
+    std::vector<bool> changedGroupIds;
+    if(oldSnapshot != nullptr)
+    {
+        changedGroupIds.resize(m_registeredConfigs->numberOfNames(), false);
+        for(const std::string &groupName : *changedGroups)
+        {
+            const uint32_t groupId = m_registeredConfigs->getNameId(groupName);
+            if(groupId != UNKNOWN_CONFIG_NAME) {
+                changedGroupIds[groupId] = true;
+            }
+        }
+    }
+
+    // validate new config-file against the registered items
+    bool valid = true;
+    for(const ConfigRegistry<ConfigEntry>::Item &item : *m_registeredConfigs)
+    {
+        const ConfigEntry &entry = item.value;
+        const ConfigType storageType = getStorageType(entry.type);
+
+        if(oldSnapshot != nullptr
+                && changedGroupIds[item.groupId] == false)
+        {
+            unchanged[storageType][entry.index] = true;
+            continue;
+        }
+
+        const std::string &groupName = m_registeredConfigs->getName(item.groupId);
+        const std::string &itemName = m_registeredConfigs->getName(item.itemId);
+        DataItem* value = iniItem.get(groupName, itemName);
+        if(checkItemType(value, entry.type) == false)
+        {
+            error.addMeesage(operation + " because item has the false value type: \n"
+                             "    group: \'" + groupName + "\'\n"
+                             "    item: \'" + itemName + "\'");
+            valid = false;
+        }
+        else if(entry.required
+                && value == nullptr)
+        {
+            error.addMeesage(operation + " because required value was not set "
+                             "in the config: \n"
+                             "    group: \'" + groupName + "\'\n"
+                             "    item: \'" + itemName + "\'");
+            valid = false;
+        }
+
+        values[storageType][entry.index] = std::make_pair(value, entry.type);
+    }
+
+    if(valid == false) {
+        return nullptr;
+    }
+
+    // build new snapshot
+    ConfigSnapshot* newSnapshot = new ConfigSnapshot();
+    for(uint32_t type = STRING_TYPE; type <= STRING_ARRAY_TYPE; type++)
+    {
+        for(uint32_t index = 0; index < values[type].size(); index++)
+        {
+            if(unchanged[type][index]) {
+                copyValue(newSnapshot, oldSnapshot, static_cast<ConfigType>(type), index);
+            }
+            else {
+                const auto& [value, configType] = values[type][index];
+                appendValue(newSnapshot, value, configType, index);
+            }
+        }
+    }
+
+    return newSnapshot;
+}
+
+/**
+ * @brief stop using the cache, because a registration doesn't match the cache. The config-file is
+ *        parsed and the values of all items, which were registered with the help of the cache
+ *        so far, are validated and converted again from the parsed file.
+ *
+ * @param error reference for error-output
+ *
+ * @return false, if the config-file is invalid for the already registered items, else true
+ */
+bool
+ConfigHandler::dropConfigCache(ErrorContainer &error)
+{
+    delete m_configCache;
+    m_configCache = nullptr;
+
+    // parse sources
+    LoadPhaseTimer parseTimer(m_loadProfile.parseTime);
+    m_loadProfile.cacheHit = false;
+    std::vector<SourceContent> contents;
+    m_iniItem = new IniItem();
+    m_valueOrigins.clear();
+    const bool result = restoreSources(contents, error)
+                        && parseSources(contents, nullptr, *m_iniItem, m_valueOrigins, error);
+    m_sourceContents.clear();
+    m_sourceContents.shrink_to_fit();
+    if(result == false) {
+        return false;
+    }
+    m_valueOriginsLoaded = true;
+
+    ConfigSnapshot* newSnapshot = buildSnapshot(*m_iniItem, "Config registration failed", error);
+    if(newSnapshot == nullptr) {
+        return false;
+    }
+
+    // the config is not sealed yet, so there are no other readers of the old snapshot
+    delete m_snapshot.exchange(newSnapshot);
+
+    return true;
+}
+
+/**
+ * @brief write the values of all registered items into the cache-file, if the file doesn't
+ *        already contain exactly these registrations. Failing to write the cache is not an error
+ *        for the config itself.
+ */
+void
+ConfigHandler::writeConfigCache()
+{
+    // collect all registered items ordered by type and index
+    std::vector<std::vector<ConfigCache::CacheEntry>> entries(STRING_ARRAY_TYPE + 1);
+    for(uint32_t type = STRING_TYPE; type <= STRING_ARRAY_TYPE; type++) {
+        entries[type].resize(getNumberOfValues(static_cast<ConfigType>(type)));
+    }
+
+    for(const ConfigRegistry<ConfigEntry>::Item &item : *m_registeredConfigs)
+    {
+        const std::string &groupName = m_registeredConfigs->getName(item.groupId);
+        const std::string &itemName = m_registeredConfigs->getName(item.itemId);
+        const ConfigEntry &entry = item.value;
+
+        ConfigCache::CacheEntry& cacheEntry = entries[getStorageType(entry.type)][entry.index];
+        cacheEntry.groupName = groupName;
+        cacheEntry.itemName = itemName;
+        cacheEntry.type = entry.type;
+        cacheEntry.required = entry.required;
+
+        // without parsed config-file all registrations were taken from the cache
+        if(m_iniItem != nullptr) {
+            cacheEntry.inFile = m_iniItem->get(groupName, itemName) != nullptr;
+        }
+        else {
+            cacheEntry.inFile = m_configCache->isInFile(entry.type, entry.index);
+        }
+    }
+
+    // cache is already up-to-date
+    if(m_configCache != nullptr
+            && m_configCache->schemaHash == ConfigCache::hashSchema(entries))
+    {
+        return;
+    }
+
+    ErrorContainer error;
+    if(ConfigCache::writeCache(m_cacheFilePath,
+                               m_contentHash,
+                               entries,
+                               *m_snapshot.load(),
+                               error) == false)
+    {
+        LOG_WARNING(error.toString());
+    }
+}
+
+/**
+ * @brief convert a parsed value and append it to a snapshot
+ *
+ * @param snapshot snapshot, where the value should be appended
+ * @param value parsed value from the config-file, or nullptr to use the default-value
+ * @param type type of the value
+ * @param index index of the registered item, which is used to get the default-value
+ */
+void
+ConfigHandler::appendValue(ConfigSnapshot* snapshot,
+                           DataItem* value,
+                           const ConfigType type,
+                           const uint32_t index)
+{
+    switch(type)
+    {
+        case STRING_TYPE:
+        {
+            if(value != nullptr) {
+                snapshot->appendString(value->toValue()->getString());
+            }
+            else {
+                snapshot->appendString(m_defaults->getString(index));
+            }
+            break;
+        }
+        case INT_TYPE:
+        {
+            if(value != nullptr) {
+                snapshot->appendInteger(value->toValue()->getLong());
+            }
+            else {
+                snapshot->appendInteger(m_defaults->getInteger(index));
+            }
+            break;
+        }
+        case FLOAT_TYPE:
+        {
+            if(value != nullptr) {
+                snapshot->appendFloat(value->toValue()->getDouble());
+            }
+            else {
+                snapshot->appendFloat(m_defaults->getFloat(index));
+            }
+            break;
+        }
+        case BOOL_TYPE:
+        {
+            if(value != nullptr) {
+                snapshot->appendBoolean(value->toValue()->getBool());
+            }
+            else {
+                snapshot->appendBoolean(m_defaults->getBoolean(index));
+            }
+            break;
+        }
+        case STRING_ARRAY_TYPE:
+        {
+            if(value != nullptr)
+            {
+                std::vector<std::string> result;
+                DataArray* array = value->toArray();
+                for(uint32_t i = 0; i < array->size(); i++) {
+                    result.push_back(array->get(i)->toValue()->getString());
+                }
+                snapshot->appendStringArray(result);
+            }
+            else
+            {
+                snapshot->appendStringArray(m_defaults->getStringArray(index));
+            }
+            break;
+        }
+        case DURATION_TYPE:
+        case BYTE_SIZE_TYPE:
+        {
+            long result = m_defaults->getInteger(index);
+            if(value != nullptr) {
+                convertUnitValue(value, type, result);
+            }
+            snapshot->appendInteger(result);
+            break;
+        }
+        case UNDEFINED_TYPE:
+            break;
+    }
+}
+
+/**
+ * @brief append the value of an item from another snapshot
+ *
+ * @param snapshot snapshot, where the value should be appended
+ * @param source snapshot with the value
+ * @param type type of the item
+ * @param index index of the value of the item
+ */
+void
+ConfigHandler::copyValue(ConfigSnapshot* snapshot,
+                         const ConfigSnapshot* source,
+                         const ConfigType type,
+                         const uint32_t index)
+{
+    switch(type)
+    {
+        case STRING_TYPE:
+            snapshot->appendString(source->getString(index));
+            break;
+        case INT_TYPE:
+        case DURATION_TYPE:
+        case BYTE_SIZE_TYPE:
+            snapshot->appendInteger(source->getInteger(index));
+            break;
+        case FLOAT_TYPE:
+            snapshot->appendFloat(source->getFloat(index));
+            break;
+        case BOOL_TYPE:
+            snapshot->appendBoolean(source->getBoolean(index));
+            break;
+        case STRING_ARRAY_TYPE:
+            snapshot->appendStringArray(source->getStringArray(index));
+            break;
+        case UNDEFINED_TYPE:
+            break;
+    }
+}
+
+/**
+ * @brief compare the values of all registered items of two snapshots. Nothing is compared, as
+ *        long as there are no subscriptions.
+ *
+ * @param oldSnapshot snapshot before the reload
+ * @param newSnapshot snapshot after the reload
+ * @param changes reference for the resulting list of changed items
+ */
+void
+ConfigHandler::collectChanges(const ConfigSnapshot* oldSnapshot,
+                              const ConfigSnapshot* newSnapshot,
+                              std::vector<ConfigChange> &changes)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_subscriptionLock);
+        if(m_subscriptions.size() == 0) {
+            return;
+        }
+    }
+
+    for(const ConfigRegistry<ConfigEntry>::Item &item : *m_registeredConfigs)
+    {
+        const uint32_t index = item.value.index;
+        bool changed = false;
+
+        switch(item.value.type)
+        {
+            case STRING_TYPE:
+                changed = oldSnapshot->getStringView(index) != newSnapshot->getStringView(index);
+                break;
+            case INT_TYPE:
+            case DURATION_TYPE:
+            case BYTE_SIZE_TYPE:
+                changed = oldSnapshot->getInteger(index) != newSnapshot->getInteger(index);
+                break;
+            case FLOAT_TYPE:
+                changed = oldSnapshot->getFloat(index) != newSnapshot->getFloat(index);
+                break;
+            case BOOL_TYPE:
+                changed = oldSnapshot->getBoolean(index) != newSnapshot->getBoolean(index);
+                break;
+            case STRING_ARRAY_TYPE:
+            {
+                const StringArrayView oldArray = oldSnapshot->getStringArrayView(index);
+                const StringArrayView newArray = newSnapshot->getStringArrayView(index);
+                changed = oldArray.size() != newArray.size()
+                          || std::equal(oldArray.begin(),
+                                        oldArray.end(),
+                                        newArray.begin()) == false;
+                break;
+            }
+            case UNDEFINED_TYPE:
+                break;
+        }
+
+        if(changed)
+        {
+            ConfigChange change;
+            change.groupName = m_registeredConfigs->getName(item.groupId);
+            change.itemName = m_registeredConfigs->getName(item.itemId);
+            change.type = item.value.type;
+            changes.push_back(change);
+        }
+    }
+}
+
+/**
+ * @brief call each subscriber, which is affected by the changes of a reload, once with all of its
+ *        changed items. The callbacks are called without holding the lock of the subscriptions,
+ *        so they are allowed to subscribe or unsubscribe.
+ *
+ * @param changes all changed items of the reload
+ */
+void
+ConfigHandler::notifySubscribers(const std::vector<ConfigChange> &changes)
+{
+    if(changes.size() == 0) {
+        return;
+    }
+
+    std::vector<Subscription> subscriptions;
+    {
+        std::lock_guard<std::mutex> guard(m_subscriptionLock);
+        subscriptions = m_subscriptions;
+    }
+
+    for(const Subscription &subscription : subscriptions)
+    {
+        std::vector<ConfigChange> relevantChanges;
+        for(const ConfigChange &change : changes)
+        {
+            if(change.groupName == subscription.groupName
+                    && (subscription.wholeGroup || change.itemName == subscription.itemName))
+            {
+                relevantChanges.push_back(change);
+            }
+        }
+
+        if(relevantChanges.size() > 0) {
+            subscription.callback(relevantChanges);
+        }
+    }
+}
+
+/**
+ * @brief wait until all readers, which started before the last swap of the snapshot, are
+ *        finished. Readers, which start during the wait, already use the new snapshot.
+ */
+void
+ConfigHandler::waitForReaders()
+{
+    // switch the counters for new readers
+    const uint64_t oldEpoch = m_readerEpoch.fetch_add(1);
+    ReaderCounter* oldReaders = m_activeReaders[oldEpoch % 2];
+
+    for(uint32_t i = 0; i < NUMBER_OF_READER_SHARDS; i++)
+    {
+        while(oldReaders[i].count.load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief split the content of a config-file into the sections of its groups by scanning the lines
+ *        for group-headers, without parsing anything else. Lines before the first group-header
+ *        belong to the group ''.
+ *
+ * @param content content of the config-file
+ * @param function function, which is called for each section with the group-name, the position
+ *                 and the size of the section within the content
+ */
+template<typename FUNC>
+static void
+forEachGroupSection(const std::string &content, FUNC function)
+{
+    std::string groupName = "";
+    uint64_t sectionStart = 0;
+    uint64_t pos = 0;
+
+    while(pos < content.size())
+    {
+        uint64_t lineEnd = content.find('\n', pos);
+        lineEnd = (lineEnd == std::string::npos) ? content.size() : lineEnd + 1;
+
+        const uint64_t first = content.find_first_not_of(" \t", pos);
+        if(first < lineEnd
+                && content[first] == '[')
+        {
+            const uint64_t closing = content.find(']', first);
+            if(closing < lineEnd)
+            {
+                if(pos > sectionStart) {
+                    function(groupName, sectionStart, pos - sectionStart);
+                }
+
+                // spaces around the name are not part of the name
+                const uint64_t nameStart = content.find_first_not_of(" \t", first + 1);
+                const uint64_t nameEnd = content.find_last_not_of(" \t", closing - 1);
+                if(nameStart < closing
+                        && nameEnd != std::string::npos
+                        && nameEnd >= nameStart)
+                {
+                    groupName = content.substr(nameStart, nameEnd - nameStart + 1);
+                }
+                else
+                {
+                    groupName = "";
+                }
+                sectionStart = pos;
+            }
+        }
+
+        pos = lineEnd;
+    }
+
+    if(content.size() > sectionStart) {
+        function(groupName, sectionStart, content.size() - sectionStart);
+    }
+}
+
+/**
+ * @brief calculate a hash of the text of each group of a config-file. If a group is split over
+ *        multiple sections, all of them are part of its hash.
+ *
+ * @param content content of the config-file
+ * @param groupHashes reference for the resulting hashes
+ */
+void
+ConfigHandler::hashGroups(const std::string &content,
+                          std::map<std::string, uint64_t> &groupHashes)
+{
+    groupHashes.clear();
+    forEachGroupSection(content, [&](const std::string &groupName,
+                                     const uint64_t position,
+                                     const uint64_t size)
+    {
+        auto it = groupHashes.find(groupName);
+        if(it == groupHashes.end()) {
+            it = groupHashes.emplace(groupName, CONFIG_HASH_SEED).first;
+        }
+        it->second = ConfigCache::hashData(content.data() + position, size, it->second);
+    });
+}
+
+/**
+ * @brief get all sections of specific groups of a config-file
+ *
+ * @param content content of the config-file
+ * @param groupNames names of the requested groups
+ *
+ * @return content with only the sections of the requested groups
+ */
+const std::string
+ConfigHandler::extractGroups(const std::string &content,
+                             const std::set<std::string> &groupNames)
+{
+    std::string result;
+    forEachGroupSection(content, [&](const std::string &groupName,
+                                     const uint64_t position,
+                                     const uint64_t size)
+    {
+        if(groupNames.count(groupName) == 0) {
+            return;
+        }
+
+        result.append(content, position, size);
+        if(result.back() != '\n') {
+            result.push_back('\n');
+        }
+    });
+
+    return result;
+}
+
+/**
+ * @brief get shard of the reader-counters for the current thread. Every thread gets its own
+ *        shard assigned round-robin, so readers on different cores don't share a cache-line.
+ *
+ * @return shard-id of the current thread
+ */
+uint32_t
+ConfigHandler::getReaderShard()
+{
+    static std::atomic<uint32_t> nextShard {0};
+    thread_local const uint32_t shard = nextShard.fetch_add(1) % NUMBER_OF_READER_SHARDS;
+    return shard;
+}
+
+/**
+ * @brief get the counters, where the getter of this handler count their reads. Overlays share
+ *        the registered items of their base and so also its counters.
+ *
+ * @return nullptr, if the library is built without instrumentation, else pointer to the counters
+ */
+ConfigAccessCounters*
+ConfigHandler::getAccessCounters()
+{
+    if(m_baseConfig != nullptr) {
+        return m_baseConfig->m_accessCounters;
+    }
+
+    return m_accessCounters;
+}
+
+/**
+ * @brief register reader of the current snapshot
+ *
+ * @param handler handler, which holds the snapshot
+ */
+ConfigHandler::SnapshotReader::SnapshotReader(ConfigHandler* handler)
+{
+#ifdef KITSUNEMIMI_CONFIG_ACCESS_STATS
+    m_accessCounters = handler->getAccessCounters();
+#endif
+
+    // the values of a frozen config are never deleted, so they can be read without registration
+    if(handler->m_frozen.load(std::memory_order_acquire))
+    {
+        snapshot = handler->m_snapshot.load(std::memory_order_relaxed);
+        m_sealed = true;
+        return;
+    }
+
+    const uint32_t shard = getReaderShard();
+    while(true)
+    {
+        const uint64_t epoch = handler->m_readerEpoch.load();
+        m_readers = &handler->m_activeReaders[epoch % 2][shard].count;
+        m_readers->fetch_add(1);
+
+        // check that the counter was not switched by a reload in the meantime, because otherwise
+        // the reload might not wait for this reader
+        if(handler->m_readerEpoch.load() == epoch) {
+            break;
+        }
+
+        m_readers->fetch_sub(1);
+    }
+
+    snapshot = handler->m_snapshot.load();
+    m_sealed = handler->m_sealed;
+}
+
+/**
+ * @brief get string-value from the pinned config
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return empty string, if the handle is invalid, else copy of the value
+ */
+const std::string
+ConfigHandler::SnapshotReader::getString(const ConfigKey<std::string> &key,
+                                         bool &success) const
+{
+    RECORD_CONFIG_ACCESS(m_accessCounters);
+    success = key.index < snapshot->numberOfStrings();
+    if(success == false) {
+        return "";
+    }
+    SET_CONFIG_ACCESS_KEY(STRING_TYPE, key.index);
+
+    return snapshot->getString(key.index);
+}
+
+/**
+ * @brief get string-value from the pinned config without copy
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return empty view, if the handle is invalid or the config is not sealed yet, else view on the
+ *         value. The view is valid as long as the reader exists.
+ */
+std::string_view
+ConfigHandler::SnapshotReader::getStringView(const ConfigKey<std::string> &key,
+                                             bool &success) const
+{
+    RECORD_CONFIG_ACCESS(m_accessCounters);
+    success = m_sealed
+              && key.index < snapshot->numberOfStrings();
+    if(success == false) {
+        return std::string_view();
+    }
+    SET_CONFIG_ACCESS_KEY(STRING_TYPE, key.index);
+
+    return snapshot->getStringView(key.index);
+}
+
+/**
+ * @brief get long-value from the pinned config
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return 0, if the handle is invalid, else the value
+ */
+long
+ConfigHandler::SnapshotReader::getInteger(const ConfigKey<long> &key,
+                                          bool &success) const
+{
+    RECORD_CONFIG_ACCESS(m_accessCounters);
+    success = key.index < snapshot->numberOfIntegers();
+    if(success == false) {
+        return 0;
+    }
+    SET_CONFIG_ACCESS_KEY(INT_TYPE, key.index);
+
+    return snapshot->getInteger(key.index);
+}
+
+/**
+ * @brief get double-value from the pinned config
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return 0.0, if the handle is invalid, else the value
+ */
+double
+ConfigHandler::SnapshotReader::getFloat(const ConfigKey<double> &key,
+                                        bool &success) const
+{
+    RECORD_CONFIG_ACCESS(m_accessCounters);
+    success = key.index < snapshot->numberOfFloats();
+    if(success == false) {
+        return 0.0;
+    }
+    SET_CONFIG_ACCESS_KEY(FLOAT_TYPE, key.index);
+
+    return snapshot->getFloat(key.index);
+}
+
+/**
+ * @brief get bool-value from the pinned config
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return false, if the handle is invalid, else the value
+ */
+bool
+ConfigHandler::SnapshotReader::getBoolean(const ConfigKey<bool> &key,
+                                          bool &success) const
+{
+    RECORD_CONFIG_ACCESS(m_accessCounters);
+    success = key.index < snapshot->numberOfBooleans();
+    if(success == false) {
+        return false;
+    }
+    SET_CONFIG_ACCESS_KEY(BOOL_TYPE, key.index);
+
+    return snapshot->getBoolean(key.index);
+}
+
+/**
+ * @brief get string-array-value from the pinned config
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return empty vector, if the handle is invalid, else copy of the value
+ */
+const std::vector<std::string>
+ConfigHandler::SnapshotReader::getStringArray(const ConfigKey<std::vector<std::string>> &key,
+                                              bool &success) const
+{
+    RECORD_CONFIG_ACCESS(m_accessCounters);
+    success = key.index < snapshot->numberOfStringArrays();
+    if(success == false) {
+        return std::vector<std::string>();
+    }
+    SET_CONFIG_ACCESS_KEY(STRING_ARRAY_TYPE, key.index);
+
+    return snapshot->getStringArray(key.index);
+}
+
+/**
+ * @brief get string-array-value from the pinned config without copy
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return empty view, if the handle is invalid or the config is not sealed yet, else view on the
+ *         value. The view is valid as long as the reader exists.
+ */
+StringArrayView
+ConfigHandler::SnapshotReader::getStringArrayView(const ConfigKey<std::vector<std::string>> &key,
+                                                  bool &success) const
+{
+    RECORD_CONFIG_ACCESS(m_accessCounters);
+    success = m_sealed
+              && key.index < snapshot->numberOfStringArrays();
+    if(success == false) {
+        return StringArrayView();
+    }
+    SET_CONFIG_ACCESS_KEY(STRING_ARRAY_TYPE, key.index);
+
+    return snapshot->getStringArrayView(key.index);
+}
+
+/**
+ * @brief get duration-value from the pinned config
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return 0, if the handle is invalid, else value from the config-file or the
+ *         defined default-value.
+ */
+std::chrono::nanoseconds
+ConfigHandler::SnapshotReader::getDuration(const ConfigKey<std::chrono::nanoseconds> &key,
+                                           bool &success) const
+{
+    RECORD_CONFIG_ACCESS(m_accessCounters);
+    success = key.index < snapshot->numberOfIntegers();
+    if(success == false) {
+        return std::chrono::nanoseconds(0);
+    }
+    SET_CONFIG_ACCESS_KEY(DURATION_TYPE, key.index);
+
+    return std::chrono::nanoseconds(snapshot->getInteger(key.index));
+}
+
+/**
+ * @brief get byte-size-value from the pinned config
+ *
+ * @param key handle, which was returned by the registration of the value
+ * @param success reference to bool-value with the result. returns false if the handle is invalid,
+ *                else true.
+ *
+ * @return 0, if the handle is invalid, else value in bytes from the config-file or the
+ *         defined default-value.
+ */
+uint64_t
+ConfigHandler::SnapshotReader::getByteSize(const ConfigKey<uint64_t> &key,
+                                           bool &success) const
+{
+    RECORD_CONFIG_ACCESS(m_accessCounters);
+    success = key.index < snapshot->numberOfIntegers();
+    if(success == false) {
+        return 0;
+    }
+    SET_CONFIG_ACCESS_KEY(BYTE_SIZE_TYPE, key.index);
+
+    return static_cast<uint64_t>(snapshot->getInteger(key.index));
+}
+
+/**
+ * @brief unregister reader
+ */
+ConfigHandler::SnapshotReader::~SnapshotReader()
+{
+    if(m_readers != nullptr) {
+        m_readers->fetch_sub(1);
+    }
+}
+
+/**
+ * @brief check if defined type match with the type of the value within the config-file
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param type type-identifier
+ *
+ * @return true, if type match with the config-file, else false
+ */
+bool
+ConfigHandler::checkType(const std::string &groupName,
+                         const std::string &itemName,
+                         const ConfigType type)
+{
+    return checkItemType(m_iniItem->get(groupName, itemName), type);
+}
+
+/**
+ * @brief check if defined type match with the type of a parsed value
+ *
+ * @param currentItem parsed value from the config-file
+ * @param type type-identifier
+ *
+ * @return true, if type match or the value is not set, else false
+ */
+bool
+ConfigHandler::checkItemType(DataItem* currentItem,
+                             const ConfigType type)
+{
+    // precheck
+    if(currentItem == nullptr) {
+        return true;
+    }
+
+    // check for array
+    if(currentItem->getType() == DataItem::ARRAY_TYPE
+            && type == ConfigType::STRING_ARRAY_TYPE)
+    {
+        return true;
+    }
+
+    // check value
+    if(currentItem->getType() == DataItem::VALUE_TYPE)
+    {
+        DataValue* value = currentItem->toValue();
+
+        // check string
+        if(value->getValueType() == DataValue::STRING_TYPE
+                && type == ConfigType::STRING_TYPE)
+        {
+            return true;
+        }
+
+        // check integer
+        if(value->getValueType() == DataValue::INT_TYPE
+                && type == ConfigType::INT_TYPE)
+        {
+            return true;
+        }
+
+        // check float
+        if(value->getValueType() == DataValue::FLOAT_TYPE
+                && type == ConfigType::FLOAT_TYPE)
+        {
+            return true;
+        }
+
+        // check boolean
+        if(value->getValueType() == DataValue::BOOL_TYPE
+                && type == ConfigType::BOOL_TYPE)
+        {
+            return true;
+        }
+
+        // check value with unit
+        long result = 0;
+        if(type == ConfigType::DURATION_TYPE
+                || type == ConfigType::BYTE_SIZE_TYPE)
+        {
+            return convertUnitValue(currentItem, type, result);
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief convert a parsed value with a unit into the integer, which is stored for the item
+ *
+ * @param currentItem parsed value from the config-file
+ * @param type duration-type or byte-size-type
+ * @param result reference for the resulting nanoseconds or bytes
+ *
+ * @return false, if the value is no integer or string or has no valid unit, else true
+ */
+bool
+ConfigHandler::convertUnitValue(DataItem* currentItem,
+                                const ConfigType type,
+                                long &result)
+{
+    DataValue* value = currentItem->toValue();
+    if(value == nullptr) {
+        return false;
+    }
+
+    // plain integers have the base-unit of the type
+    std::string input;
+    if(value->getValueType() == DataValue::INT_TYPE) {
+        input = std::to_string(value->getLong()) + (type == DURATION_TYPE ? "s" : "B");
+    }
+    else if(value->getValueType() == DataValue::STRING_TYPE) {
+        input = value->getString();
+    }
+    else {
+        return false;
+    }
+
+    if(type == DURATION_TYPE) {
+        return parseDuration(input, result);
+    }
+    if(type == BYTE_SIZE_TYPE) {
+        return parseByteSize(input, result);
+    }
+
+    return false;
+}
+
+/**
+ * @brief parse a duration, which consists of one or more integers with a unit, like '1h30m' or
+ *        '250ms'. Supported units are 'ns', 'us', 'ms', 's', 'm', 'h' and 'd'. An integer without
+ *        unit is taken as seconds.
+ *
+ * @param input string to parse
+ * @param result reference for the resulting nanoseconds
+ *
+ * @return false, if the string is empty, negative, has an unknown unit or the duration doesn't
+ *         fit into 64 bit, else true
+ */
+bool
+ConfigHandler::parseDuration(const std::string &input,
+                             long &result)
+{
+    const std::vector<std::pair<std::string, long>> units = {
+        {"ns", 1l},
+        {"us", 1000l},
+        {"ms", 1000000l},
+        {"s", 1000000000l},
+        {"m", 60000000000l},
+        {"h", 3600000000000l},
+        {"d", 86400000000000l},
+    };
+
+    // plain integer without unit
+    std::string value = input;
+    if(value.size() > 0
+            && value.find_first_not_of("0123456789") == std::string::npos)
+    {
+        value.push_back('s');
+    }
+
+    uint64_t pos = 0;
+    result = 0;
+    while(pos < value.size())
+    {
+        // integer
+        const uint64_t start = pos;
+        long number = 0;
+        while(pos < value.size()
+                && isdigit(static_cast<unsigned char>(value[pos])))
+        {
+            if(__builtin_mul_overflow(number, 10l, &number)
+                    || __builtin_add_overflow(number, static_cast<long>(value[pos] - '0'), &number))
+            {
+                return false;
+            }
+            pos++;
+        }
+        if(pos == start) {
+            return false;
+        }
+
+        // unit
+        const uint64_t unitStart = pos;
+        while(pos < value.size()
+                && isalpha(static_cast<unsigned char>(value[pos])))
+        {
+            pos++;
+        }
+        const std::string unit = value.substr(unitStart, pos - unitStart);
+
+        std::vector<std::pair<std::string, long>>::const_iterator it;
+        it = std::find_if(units.begin(),
+                          units.end(),
+                          [&unit](const std::pair<std::string, long> &entry) {
+                              return entry.first == unit;
+                          });
+        if(it == units.end()) {
+            return false;
+        }
+
+        if(__builtin_mul_overflow(number, it->second, &number)
+                || __builtin_add_overflow(result, number, &result))
+        {
+            return false;
+        }
+    }
+
+    return value.size() > 0;
+}
+
+/**
+ * @brief parse a byte-size, which is an integer with a unit, like '64KiB' or '10MB'. Supported
+ *        units are 'B', 'kB' (also 'KB'), 'MB', 'GB', 'TB' and 'PB' with a factor of 1000 and
+ *        'KiB', 'MiB', 'GiB', 'TiB' and 'PiB' with a factor of 1024. An integer without unit is
+ *        taken as bytes.
+ *
+ * @param input string to parse
+ * @param result reference for the resulting bytes. Sizes above the maximum of long are stored
+ *               with the bits of an unsigned value.
+ *
+ * @return false, if the string is empty, negative, has an unknown unit or the size doesn't fit
+ *         into 64 bit, else true
+ */
+bool
+ConfigHandler::parseByteSize(const std::string &input,
+                             long &result)
+{
+    const std::vector<std::pair<std::string, uint64_t>> units = {
+        {"", 1ull},
+        {"B", 1ull},
+        {"kB", 1000ull},
+        {"KB", 1000ull},
+        {"MB", 1000ull * 1000},
+        {"GB", 1000ull * 1000 * 1000},
+        {"TB", 1000ull * 1000 * 1000 * 1000},
+        {"PB", 1000ull * 1000 * 1000 * 1000 * 1000},
+        {"KiB", 1ull << 10},
+        {"MiB", 1ull << 20},
+        {"GiB", 1ull << 30},
+        {"TiB", 1ull << 40},
+        {"PiB", 1ull << 50},
+    };
+
+    // integer
+    uint64_t pos = 0;
+    uint64_t number = 0;
+    while(pos < input.size()
+            && isdigit(static_cast<unsigned char>(input[pos])))
+    {
+        if(__builtin_mul_overflow(number, 10ull, &number)
+                || __builtin_add_overflow(number, static_cast<uint64_t>(input[pos] - '0'), &number))
+        {
+            return false;
+        }
+        pos++;
+    }
+    if(pos == 0) {
+        return false;
+    }
+
+    // unit
+    const std::string unit = input.substr(pos);
+    std::vector<std::pair<std::string, uint64_t>>::const_iterator it;
+    it = std::find_if(units.begin(),
+                      units.end(),
+                      [&unit](const std::pair<std::string, uint64_t> &entry) {
+                          return entry.first == unit;
+                      });
+    if(it == units.end()
+            || __builtin_mul_overflow(number, it->second, &number))
+    {
+        return false;
+    }
+
+    result = static_cast<long>(number);
+    return true;
+}
+
+/**
+ * @brief check, if an item-name and group-name are already registered
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ *
+ * @return true, if item-name and group-name is already registered, else false
+ */
+bool
+ConfigHandler::isRegistered(std::string_view groupName,
+                            std::string_view itemName)
+{
+    if(getRegisteredType(groupName, itemName) == ConfigType::UNDEFINED_TYPE) {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief get number of registered values of a specific type, which is also the index of the
+ *        next registered value of this type
+ *
+ * @param type type of the values
+ *
+ * @return number of values
+ */
+uint32_t
+ConfigHandler::getNumberOfValues(const ConfigType type) const
+{
+    switch(type)
+    {
+        case STRING_TYPE:       return m_defaults->numberOfStrings();
+        case INT_TYPE:          return m_defaults->numberOfIntegers();
+        case FLOAT_TYPE:        return m_defaults->numberOfFloats();
+        case BOOL_TYPE:         return m_defaults->numberOfBooleans();
+        case STRING_ARRAY_TYPE: return m_defaults->numberOfStringArrays();
+        case DURATION_TYPE:     return m_defaults->numberOfIntegers();
+        case BYTE_SIZE_TYPE:    return m_defaults->numberOfIntegers();
+        case UNDEFINED_TYPE:    break;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief get the type of the value-list, where the values of a type are stored
+ *
+ * @param type registered type
+ *
+ * @return integer-type for all values with a unit, else the type itself
+ */
+ConfigHandler::ConfigType
+ConfigHandler::getStorageType(const ConfigType type)
+{
+    if(type == DURATION_TYPE
+            || type == BYTE_SIZE_TYPE)
+    {
+        return INT_TYPE;
+    }
+
+    return type;
+}
+
+/**
+ * @brief register type
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param type type-identifier to register
+ * @param required true, if the value must be in the config-file
+ *
+ * @return false, if item-name and group-name are already registered, else true
+ */
+bool
+ConfigHandler::registerType(const std::string &groupName,
+                            const std::string &itemName,
+                            const ConfigType type,
+                            const bool required)
+{
+    // the value of the new item will be appended to the value-list of its type, so the index
+    // of the new item is the current size of this list
+    ConfigEntry newEntry;
+    newEntry.type = type;
+    newEntry.required = required;
+    newEntry.index = getNumberOfValues(type);
+
+    // insert fails, if the item already exist
+    if(m_registeredConfigs->insert(groupName, itemName, newEntry) == false) {
+        return false;
+    }
+
+    if(m_accessCounters != nullptr) {
+        m_accessCounters->addKey(type);
+    }
+
+    return true;
+}
+
+/**
+ * @brief get registered config-type
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ *
+ * @return undefined-type, if item-name and group-name are not registered, else the registered type
+ */
+ConfigHandler::ConfigType
+ConfigHandler::getRegisteredType(std::string_view groupName,
+                                 std::string_view itemName)
+{
+    const ConfigEntry* entry = getRegisteredEntry(groupName, itemName);
+    if(entry == nullptr) {
+        return UNDEFINED_TYPE;
+    }
+
+    return entry->type;
+}
+
+/**
+ * @brief get registered config-entry
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ *
+ * @return nullptr, if item-name and group-name are not registered, else pointer to the entry
+ */
+const ConfigHandler::ConfigEntry*
+ConfigHandler::getRegisteredEntry(std::string_view groupName,
+                                  std::string_view itemName)
+{
+    return m_registeredConfigs->find(groupName, itemName);
+}
+
+/**
+ * @brief register single value in the config
  *
  * @param groupName name of the group
  * @param itemName name of the item within the group
@@ -846,47 +4268,389 @@ ConfigHandler::registerValue(std::string &groupName,
                              const bool required,
                              ErrorContainer &error)
 {
+    m_loadProfile.numberOfRegistrations++;
+
     // if group-name is empty, then use the default-group
     if(groupName.size() == 0) {
         groupName = "DEFAULT";
     }
 
-    // check type against config-file
-    if(checkType(groupName, itemName, type) == false)
+    // check if registration-phase is already finished
+    if(m_sealed)
     {
-        error.addMeesage("Config registration failed because item has the false value type: \n"
-                         "    group: \'" + groupName + "\'\n"
-                         "    item: \'" + itemName + "\'");
-        LOG_ERROR(error);
-        m_configValid = false;
+        addRegistrationError(error, "config is already sealed", groupName, itemName);
         return false;
     }
 
-    // check if value is required
-    if(required
-            && m_iniItem->get(groupName, itemName) == nullptr)
+    // merging the environment doesn't register anything, so the lookup is done only once
+    const bool alreadyRegistered = isRegistered(groupName, itemName);
+
+    // merge the value of the environment before the check, so it is checked like a file-value
+    if(alreadyRegistered == false
+            && applyEnvironment(groupName, itemName, error) == false)
     {
-        error.addMeesage("Config registration failed because required "
-                         "value was not set in the config: \n"
-                         "    group: \'" + groupName + "\'\n"
-                         "    item: \'" + itemName + "\'");
-        LOG_ERROR(error);
-        m_configValid = false;
+        addRegistrationError(error, "of the environment", groupName, itemName);
+        return false;
+    }
+
+    // registrations, which are the same like in the cache, were already checked against the
+    // same config-file, when the cache was written. Any other registration needs the parsed file.
+    if(m_configCache != nullptr
+            && alreadyRegistered == false
+            && m_configCache->matches(groupName,
+                                      itemName,
+                                      type,
+                                      required,
+                                      getNumberOfValues(type)) == false
+            && dropConfigCache(error) == false)
+    {
+        addRegistrationError(error, "config-file could not be checked", groupName, itemName);
         return false;
     }
 
+    if(m_configCache == nullptr)
+    {
+        // check type against config-file
+        LoadPhaseTimer checkTypeTimer(m_loadProfile.checkTypeTime);
+        const bool typeMatches = checkType(groupName, itemName, type);
+        checkTypeTimer.stop();
+        if(typeMatches == false)
+        {
+            addRegistrationError(error, "item has the false value type", groupName, itemName);
+            return false;
+        }
+
+        // check if value is required
+        if(required
+                && m_iniItem->get(groupName, itemName) == nullptr)
+        {
+            addRegistrationError(error,
+                                 "required value was not set in the config",
+                                 groupName,
+                                 itemName);
+            return false;
+        }
+    }
+
     // try to register type
-    if(registerType(groupName, itemName, type) == false)
+    LoadPhaseTimer registerTypeTimer(m_loadProfile.registerTypeTime);
+    const bool inserted = registerType(groupName, itemName, type, required);
+    registerTypeTimer.stop();
+    if(inserted == false)
     {
-        error.addMeesage("Config registration failed because item is already registered: \n"
-                         "    group: \'" + groupName + "\'\n"
-                         "    item: \'" + itemName + "\'");
-        LOG_ERROR(error);
-        m_configValid = false;
+        addRegistrationError(error, "item is already registered", groupName, itemName);
         return false;
     }
 
     return true;
 }
 
+/**
+ * @brief add the error-message of a failed registration and mark the config as invalid
+ *
+ * @param error reference for error-output
+ * @param reason reason of the failure, which completes the sentence 'registration failed because'
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param logError true to write the error-message also into the log
+ */
+void
+ConfigHandler::addRegistrationError(ErrorContainer &error,
+                                    const std::string &reason,
+                                    const std::string &groupName,
+                                    const std::string &itemName,
+                                    const bool logError)
+{
+    LoadPhaseTimer errorTimer(m_loadProfile.errorFormattingTime);
+    m_loadProfile.numberOfRegistrationErrors++;
+
+    error.addMeesage("Config registration failed because " + reason + ": \n"
+                     "    group: \'" + groupName + "\'\n"
+                     "    item: \'" + itemName + "\'");
+    if(logError) {
+        LOG_ERROR(error);
+    }
+    m_configValid = false;
+}
+
+/**
+ * @brief add the number and size of the read sources to the load-profile
+ *
+ * @param contents content of the read sources
+ */
+void
+ConfigHandler::countSources(const std::vector<SourceContent> &contents)
+{
+    m_loadProfile.numberOfSources += contents.size();
+    for(const SourceContent &sourceContent : contents) {
+        m_loadProfile.bytesRead += sourceContent.content.size();
+    }
+}
+
+//==================================================================================================
+
+/**
+ * @brief create item of a schema for a string-value
+ */
+ConfigSpec
+ConfigSpec::forString(const std::string &groupName,
+                      const std::string &itemName,
+                      const std::string &defaultValue,
+                      const bool required)
+{
+    ConfigSpec spec;
+    spec.groupName = groupName;
+    spec.itemName = itemName;
+    spec.type = ConfigHandler::STRING_TYPE;
+    spec.stringDefault = defaultValue;
+    spec.required = required;
+    return spec;
+}
+
+/**
+ * @brief create item of a schema for an integer-value
+ */
+ConfigSpec
+ConfigSpec::forInteger(const std::string &groupName,
+                       const std::string &itemName,
+                       const long defaultValue,
+                       const bool required)
+{
+    ConfigSpec spec;
+    spec.groupName = groupName;
+    spec.itemName = itemName;
+    spec.type = ConfigHandler::INT_TYPE;
+    spec.intDefault = defaultValue;
+    spec.required = required;
+    return spec;
+}
+
+/**
+ * @brief create item of a schema for a float-value
+ */
+ConfigSpec
+ConfigSpec::forFloat(const std::string &groupName,
+                     const std::string &itemName,
+                     const double defaultValue,
+                     const bool required)
+{
+    ConfigSpec spec;
+    spec.groupName = groupName;
+    spec.itemName = itemName;
+    spec.type = ConfigHandler::FLOAT_TYPE;
+    spec.floatDefault = defaultValue;
+    spec.required = required;
+    return spec;
+}
+
+/**
+ * @brief create item of a schema for a bool-value
+ */
+ConfigSpec
+ConfigSpec::forBoolean(const std::string &groupName,
+                       const std::string &itemName,
+                       const bool defaultValue,
+                       const bool required)
+{
+    ConfigSpec spec;
+    spec.groupName = groupName;
+    spec.itemName = itemName;
+    spec.type = ConfigHandler::BOOL_TYPE;
+    spec.boolDefault = defaultValue;
+    spec.required = required;
+    return spec;
+}
+
+/**
+ * @brief create item of a schema for a string-array-value
+ */
+ConfigSpec
+ConfigSpec::forStringArray(const std::string &groupName,
+                           const std::string &itemName,
+                           const std::vector<std::string> &defaultValue,
+                           const bool required)
+{
+    ConfigSpec spec;
+    spec.groupName = groupName;
+    spec.itemName = itemName;
+    spec.type = ConfigHandler::STRING_ARRAY_TYPE;
+    spec.stringArrayDefault = defaultValue;
+    spec.required = required;
+    return spec;
+}
+
+/**
+ * @brief create item of a schema for a duration-value
+ */
+ConfigSpec
+ConfigSpec::forDuration(const std::string &groupName,
+                        const std::string &itemName,
+                        const std::chrono::nanoseconds defaultValue,
+                        const bool required)
+{
+    ConfigSpec spec;
+    spec.groupName = groupName;
+    spec.itemName = itemName;
+    spec.type = ConfigHandler::DURATION_TYPE;
+    spec.durationDefault = defaultValue;
+    spec.required = required;
+    return spec;
+}
+
+/**
+ * @brief create item of a schema for a byte-size-value
+ */
+ConfigSpec
+ConfigSpec::forByteSize(const std::string &groupName,
+                        const std::string &itemName,
+                        const uint64_t defaultValue,
+                        const bool required)
+{
+    ConfigSpec spec;
+    spec.groupName = groupName;
+    spec.itemName = itemName;
+    spec.type = ConfigHandler::BYTE_SIZE_TYPE;
+    spec.byteSizeDefault = defaultValue;
+    spec.required = required;
+    return spec;
+}
+
+//==================================================================================================
+
+/**
+ * @brief add config-file with a higher precedence than all files, which were added before
+ *
+ * @param filePath path to the config-file
+ */
+void
+ConfigSources::addFile(const std::string &filePath)
+{
+    filePaths.push_back(filePath);
+}
+
+/**
+ * @brief add all config-files of a directory in the order of their names with a higher precedence
+ *        than all files, which were added before. Items, which are set by more than one file of
+ *        the directory, are reported as conflict.
+ *
+ * @param directoryPath path of the directory with an optional pattern for the file-names like
+ *                      '*.ini' as last part. Without pattern all files with ending '.ini' are used.
+ */
+void
+ConfigSources::addDirectory(const std::string &directoryPath)
+{
+    filePaths.push_back(directoryPath);
+}
+
+/**
+ * @brief set the number of threads for reading the config-files. The parsing always runs on
+ *        the calling thread.
+ *
+ * @param numberOfThreads number of threads, or 0 to use one thread per cpu-core
+ */
+void
+ConfigSources::setNumberOfThreads(const uint32_t numberOfThreads)
+{
+    this->numberOfThreads = numberOfThreads;
+}
+
+/**
+ * @brief use environment-variables to override the values of the registered items. The variable
+ *        of an item is '<PREFIX>_<GROUP>_<ITEM>' in upper-case, where all characters other than
+ *        letters and digits are replaced by '_'. The environment is read once at the
+ *        initialization.
+ *
+ * @param prefix prefix of the environment-variables
+ */
+void
+ConfigSources::addEnvironment(const std::string &prefix)
+{
+    environmentPrefix = prefix;
+}
+
+/**
+ * @brief add single value, which overrides the value of all config-files
+ *
+ * @param source source of the value, which defines its precedence
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param value value in the same syntax like in a config-file
+ * @param origin optional description, where the value comes from
+ */
+void
+ConfigSources::addOverride(const ConfigHandler::ConfigSource source,
+                           const std::string &groupName,
+                           const std::string &itemName,
+                           const std::string &value,
+                           const std::string &origin)
+{
+    ConfigOverride configOverride;
+    configOverride.source = source;
+    configOverride.origin = origin;
+    configOverride.groupName = groupName;
+    configOverride.itemName = itemName;
+    configOverride.value = value;
+    overrides.push_back(configOverride);
+}
+
+/**
+ * @brief add the overrides of the command-line, which have the form '--set group.item=value' or
+ *        '--set=group.item=value'. All other arguments are ignored, so the same arguments can be
+ *        given to other argument-parsers.
+ *
+ * @param argc number of arguments
+ * @param argv arguments of the main-function
+ * @param error reference for error-output
+ *
+ * @return false, if an override is incomplete, else true
+ */
+bool
+ConfigSources::addArguments(const int argc,
+                            const char* const argv[],
+                            ErrorContainer &error)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        const std::string argument = argv[i];
+        std::string definition = "";
+        if(argument == "--set")
+        {
+            if(i + 1 >= argc)
+            {
+                error.addMeesage("Missing value for argument \'--set\'");
+                return false;
+            }
+            definition = argv[++i];
+        }
+        else if(argument.compare(0, 6, "--set=") == 0)
+        {
+            definition = argument.substr(6);
+        }
+        else
+        {
+            continue;
+        }
+
+        const size_t separator = definition.find('=');
+        const size_t dot = definition.find('.');
+        if(separator == std::string::npos
+                || dot == std::string::npos
+                || dot == 0
+                || dot + 1 >= separator)
+        {
+            error.addMeesage("Invalid config-argument \'" + definition + "\', "
+                             "expected \'--set group.item=value\'");
+            return false;
+        }
+
+        addOverride(ConfigHandler::COMMAND_LINE_SOURCE,
+                    definition.substr(0, dot),
+                    definition.substr(dot + 1, separator - dot - 1),
+                    definition.substr(separator + 1),
+                    "--set " + definition);
+    }
+
+    return true;
+}
+
 } // namespace Kitsunemimi
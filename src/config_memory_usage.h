@@ -0,0 +1,76 @@
+/**
+ *  @file       config_memory_usage.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_MEMORY_USAGE_H
+#define CONFIG_MEMORY_USAGE_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <stdint.h>
+
+// each node of a std::map holds its color and three pointers in addition to the stored pair
+#define CONFIG_TREE_NODE_OVERHEAD (4 * sizeof(void*))
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief get the heap-memory of a string. Short strings are stored within the string-object
+ *        itself and have no heap-memory at all.
+ *
+ * @param value string to check
+ *
+ * @return number of allocated bytes including the terminating null-character
+ */
+inline uint64_t
+getHeapSize(const std::string &value)
+{
+    const uintptr_t data = reinterpret_cast<uintptr_t>(value.data());
+    const uintptr_t object = reinterpret_cast<uintptr_t>(&value);
+    if(data >= object
+            && data < object + sizeof(std::string))
+    {
+        return 0;
+    }
+
+    return value.capacity() + 1;
+}
+
+/**
+ * @brief get the heap-memory of the array of a vector without the heap-memory of its elements
+ *
+ * @param value vector to check
+ *
+ * @return number of allocated bytes
+ */
+template<typename T>
+inline uint64_t
+getHeapSize(const std::vector<T> &value)
+{
+    return value.capacity() * sizeof(T);
+}
+
+/**
+ * @brief get the heap-memory of the nodes of a map without the heap-memory of their keys and
+ *        values
+ *
+ * @param value map to check
+ *
+ * @return number of allocated bytes
+ */
+template<typename K, typename V>
+inline uint64_t
+getNodeSize(const std::map<K, V> &value)
+{
+    return value.size() * (CONFIG_TREE_NODE_OVERHEAD + sizeof(typename std::map<K, V>::value_type));
+}
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_MEMORY_USAGE_H
@@ -0,0 +1,207 @@
+/**
+ *  @file       config_name_table.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_NAME_TABLE_H
+#define CONFIG_NAME_TABLE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <stdint.h>
+
+#include <config_memory_usage.h>
+
+#define UNKNOWN_CONFIG_NAME 0xFFFFFFFF
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief table of interned group- and item-names. Each distinct name is stored only once and is
+ *        identified by a small id, which is the position of the name in order of interning. So
+ *        names can be compared and hashed by their ids, after they were looked up once. Like the
+ *        registry, the table is an open-addressing table with linear probing, whose slots also
+ *        hold a part of the hash. Names are never removed.
+ */
+class ConfigNameTable
+{
+public:
+    ConfigNameTable()
+    {
+        m_slots.resize(16);
+    }
+
+    /**
+     * @brief get the id of a name and add the name, if it doesn't exist yet
+     *
+     * @param name name to intern
+     *
+     * @return id of the name
+     */
+    uint32_t
+    intern(const std::string_view name)
+    {
+        const uint64_t hash = hashName(name);
+        const uint64_t pos = findSlot(name, hash);
+        if(m_slots[pos].id != UNKNOWN_CONFIG_NAME) {
+            return m_slots[pos].id;
+        }
+
+        m_names.emplace_back(name);
+        m_slots[pos].id = m_names.size() - 1;
+        m_slots[pos].tag = static_cast<uint32_t>(hash >> 32);
+
+        // keep the table at most half full to keep the probe-sequences short
+        if(m_names.size() * 2 > m_slots.size()) {
+            rehash(m_slots.size() * 2);
+        }
+
+        return m_names.size() - 1;
+    }
+
+    /**
+     * @brief get the id of a name without adding it
+     *
+     * @param name name to search
+     *
+     * @return UNKNOWN_CONFIG_NAME, if the name was never interned, else id of the name
+     */
+    uint32_t
+    find(const std::string_view name) const
+    {
+        return m_slots[findSlot(name, hashName(name))].id;
+    }
+
+    /**
+     * @brief get the name of an id. The reference is only valid until the next new name is
+     *        interned.
+     *
+     * @param id id of the name, which must be valid
+     *
+     * @return interned name
+     */
+    const std::string&
+    getName(const uint32_t id) const
+    {
+        return m_names[id];
+    }
+
+    /**
+     * @brief prepare table for a specific number of names, to avoid rehashing while interning
+     *
+     * @param numberOfNames expected number of names
+     */
+    void
+    reserve(const uint64_t numberOfNames)
+    {
+        uint64_t newSize = m_slots.size();
+        while(numberOfNames * 2 > newSize) {
+            newSize *= 2;
+        }
+
+        if(newSize != m_slots.size()) {
+            rehash(newSize);
+        }
+        m_names.reserve(numberOfNames);
+    }
+
+    /**
+     * @brief get the heap-memory of the table including the names
+     *
+     * @return number of allocated bytes
+     */
+    uint64_t
+    getMemoryUsage() const
+    {
+        uint64_t size = getHeapSize(m_names) + getHeapSize(m_slots);
+        for(const std::string &name : m_names) {
+            size += getHeapSize(name);
+        }
+
+        return size;
+    }
+
+    uint64_t size() const { return m_names.size(); }
+
+private:
+    struct Slot
+    {
+        uint32_t id = UNKNOWN_CONFIG_NAME;
+        uint32_t tag = 0;
+    };
+
+    /**
+     * @brief get the slot of a name, or the empty slot, where the name would be inserted
+     */
+    uint64_t
+    findSlot(const std::string_view name,
+             const uint64_t hash) const
+    {
+        const uint64_t mask = m_slots.size() - 1;
+        const uint32_t tag = static_cast<uint32_t>(hash >> 32);
+        uint64_t pos = hash & mask;
+
+        while(m_slots[pos].id != UNKNOWN_CONFIG_NAME)
+        {
+            const Slot &slot = m_slots[pos];
+            if(slot.tag == tag
+                    && m_names[slot.id] == name)
+            {
+                return pos;
+            }
+
+            pos = (pos + 1) & mask;
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief rebuild the table with a new size, which must be a power of two
+     */
+    void
+    rehash(const uint64_t newSize)
+    {
+        m_slots.clear();
+        m_slots.resize(newSize);
+
+        const uint64_t mask = newSize - 1;
+        for(uint32_t id = 0; id < m_names.size(); id++)
+        {
+            const uint64_t hash = hashName(m_names[id]);
+            uint64_t pos = hash & mask;
+            while(m_slots[pos].id != UNKNOWN_CONFIG_NAME) {
+                pos = (pos + 1) & mask;
+            }
+
+            m_slots[pos].id = id;
+            m_slots[pos].tag = static_cast<uint32_t>(hash >> 32);
+        }
+    }
+
+    /**
+     * @brief hash a name and mix the upper bits into the lower ones, which select the slot
+     */
+    static uint64_t
+    hashName(const std::string_view name)
+    {
+        uint64_t hash = std::hash<std::string_view>()(name);
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    std::vector<std::string> m_names;
+    std::vector<Slot> m_slots;
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_NAME_TABLE_H
@@ -0,0 +1,343 @@
+/**
+ *  @file       config_registry.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_REGISTRY_H
+#define CONFIG_REGISTRY_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <stdint.h>
+
+#include <config_memory_usage.h>
+#include <config_name_table.h>
+
+#define EMPTY_REGISTRY_SLOT 0xFFFFFFFF
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief flat hash-table for the registered items, which is keyed on group- and item-name.
+ *        The names are interned in a name-table, so each distinct name is stored only once, no
+ *        matter how many items use it, and an item is identified by the ids of its names. The
+ *        items are stored densely in order of their registration and an open-addressing table
+ *        with linear probing points to them. Because the key of an item is a pair of integers,
+ *        probing compares only integers. Lookups by name take string-views, so callers don't
+ *        have to create temporary strings. They use a second table of the same size, which is
+ *        keyed on the hash of both names, so they need only one probe instead of looking up both
+ *        names in the name-table before the item itself. Items can not be removed, because
+ *        registrations are never taken back.
+ */
+template<typename T>
+class ConfigRegistry
+{
+public:
+    struct Item
+    {
+        uint32_t groupId = UNKNOWN_CONFIG_NAME;
+        uint32_t itemId = UNKNOWN_CONFIG_NAME;
+        T value;
+    };
+
+    ConfigRegistry()
+    {
+        m_slots.resize(16);
+        m_nameSlots.resize(16);
+    }
+
+    /**
+     * @brief add new item
+     *
+     * @param groupName group-name of the item
+     * @param itemName item-name of the item
+     * @param value value of the item
+     *
+     * @return false, if item already exist, else true
+     */
+    bool
+    insert(const std::string_view groupName,
+           const std::string_view itemName,
+           const T &value)
+    {
+        const uint32_t groupId = m_names.intern(groupName);
+        const uint32_t itemId = m_names.intern(itemName);
+        const uint64_t hash = hashKey(groupId, itemId);
+        const uint64_t pos = findSlot(groupId, itemId, hash);
+        if(m_slots[pos].index != EMPTY_REGISTRY_SLOT) {
+            return false;
+        }
+
+        Item newItem;
+        newItem.groupId = groupId;
+        newItem.itemId = itemId;
+        newItem.value = value;
+        m_items.push_back(newItem);
+
+        m_slots[pos].index = m_items.size() - 1;
+        m_slots[pos].tag = static_cast<uint32_t>(hash >> 32);
+        insertNameSlot(m_items.size() - 1, hashNames(groupName, itemName));
+
+        // keep the table at most half full to keep the probe-sequences short
+        if(m_items.size() * 2 > m_slots.size()) {
+            rehash(m_slots.size() * 2);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief get value of an item
+     *
+     * @param groupName group-name of the item
+     * @param itemName item-name of the item
+     *
+     * @return pointer to the value, or nullptr, if item doesn't exist
+     */
+    const T*
+    find(const std::string_view groupName,
+         const std::string_view itemName) const
+    {
+        const uint64_t hash = hashNames(groupName, itemName);
+        const uint64_t mask = m_nameSlots.size() - 1;
+        const uint32_t tag = static_cast<uint32_t>(hash >> 32);
+        uint64_t pos = hash & mask;
+
+        while(m_nameSlots[pos].index != EMPTY_REGISTRY_SLOT)
+        {
+            const Slot &slot = m_nameSlots[pos];
+            if(slot.tag == tag)
+            {
+                const Item &item = m_items[slot.index];
+                if(m_names.getName(item.itemId) == itemName
+                        && m_names.getName(item.groupId) == groupName)
+                {
+                    return &item.value;
+                }
+            }
+
+            pos = (pos + 1) & mask;
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief get value of an item by the ids of its names
+     *
+     * @param groupId id of the group-name of the item
+     * @param itemId id of the item-name of the item
+     *
+     * @return pointer to the value, or nullptr, if item doesn't exist
+     */
+    const T*
+    find(const uint32_t groupId,
+         const uint32_t itemId) const
+    {
+        const uint64_t pos = findSlot(groupId, itemId, hashKey(groupId, itemId));
+        const uint32_t index = m_slots[pos].index;
+        if(index == EMPTY_REGISTRY_SLOT) {
+            return nullptr;
+        }
+
+        return &m_items[index].value;
+    }
+
+    /**
+     * @brief get the id of a group- or item-name
+     *
+     * @param name name to search
+     *
+     * @return UNKNOWN_CONFIG_NAME, if no item uses the name, else id of the name
+     */
+    uint32_t
+    getNameId(const std::string_view name) const
+    {
+        return m_names.find(name);
+    }
+
+    /**
+     * @brief get the group- or item-name of an id
+     *
+     * @param id id of the name, which must be valid
+     *
+     * @return name, which is valid until the next insert
+     */
+    const std::string&
+    getName(const uint32_t id) const
+    {
+        return m_names.getName(id);
+    }
+
+    /**
+     * @brief prepare table for a specific number of items, to avoid rehashing while inserting
+     *
+     * @param numberOfItems expected number of items
+     */
+    void
+    reserve(const uint64_t numberOfItems)
+    {
+        uint64_t newSize = m_slots.size();
+        while(numberOfItems * 2 > newSize) {
+            newSize *= 2;
+        }
+
+        if(newSize != m_slots.size()) {
+            rehash(newSize);
+        }
+        m_items.reserve(numberOfItems);
+    }
+
+    /**
+     * @brief get the heap-memory of the registry including the names of all items
+     *
+     * @return number of allocated bytes
+     */
+    uint64_t
+    getMemoryUsage() const
+    {
+        return getHeapSize(m_items)
+               + getHeapSize(m_slots)
+               + getHeapSize(m_nameSlots)
+               + m_names.getMemoryUsage();
+    }
+
+    uint64_t size() const { return m_items.size(); }
+    uint64_t numberOfNames() const { return m_names.size(); }
+    typename std::vector<Item>::const_iterator begin() const { return m_items.begin(); }
+    typename std::vector<Item>::const_iterator end() const { return m_items.end(); }
+
+private:
+    struct Slot
+    {
+        uint32_t index = EMPTY_REGISTRY_SLOT;
+        uint32_t tag = 0;
+    };
+
+    /**
+     * @brief get the slot of an item, or the empty slot, where the item would be inserted
+     */
+    uint64_t
+    findSlot(const uint32_t groupId,
+             const uint32_t itemId,
+             const uint64_t hash) const
+    {
+        const uint64_t mask = m_slots.size() - 1;
+        const uint32_t tag = static_cast<uint32_t>(hash >> 32);
+        uint64_t pos = hash & mask;
+
+        while(m_slots[pos].index != EMPTY_REGISTRY_SLOT)
+        {
+            const Slot &slot = m_slots[pos];
+            if(slot.tag == tag)
+            {
+                const Item &item = m_items[slot.index];
+                if(item.itemId == itemId
+                        && item.groupId == groupId)
+                {
+                    return pos;
+                }
+            }
+
+            pos = (pos + 1) & mask;
+        }
+
+        return pos;
+    }
+
+    /**
+     * @brief rebuild the table with a new size, which must be a power of two
+     */
+    void
+    rehash(const uint64_t newSize)
+    {
+        m_slots.clear();
+        m_slots.resize(newSize);
+        m_nameSlots.clear();
+        m_nameSlots.resize(newSize);
+
+        const uint64_t mask = newSize - 1;
+        for(uint32_t i = 0; i < m_items.size(); i++)
+        {
+            const uint64_t hash = hashKey(m_items[i].groupId, m_items[i].itemId);
+            uint64_t pos = hash & mask;
+            while(m_slots[pos].index != EMPTY_REGISTRY_SLOT) {
+                pos = (pos + 1) & mask;
+            }
+
+            m_slots[pos].index = i;
+            m_slots[pos].tag = static_cast<uint32_t>(hash >> 32);
+
+            insertNameSlot(i, hashNames(m_names.getName(m_items[i].groupId),
+                                        m_names.getName(m_items[i].itemId)));
+        }
+    }
+
+    /**
+     * @brief add an item to the table for the lookups by name, which must not contain it yet
+     */
+    void
+    insertNameSlot(const uint32_t index,
+                   const uint64_t hash)
+    {
+        const uint64_t mask = m_nameSlots.size() - 1;
+        uint64_t pos = hash & mask;
+        while(m_nameSlots[pos].index != EMPTY_REGISTRY_SLOT) {
+            pos = (pos + 1) & mask;
+        }
+
+        m_nameSlots[pos].index = index;
+        m_nameSlots[pos].tag = static_cast<uint32_t>(hash >> 32);
+    }
+
+    /**
+     * @brief combine the ids of group- and item-name
+     */
+    static uint64_t
+    hashKey(const uint32_t groupId,
+            const uint32_t itemId)
+    {
+        uint64_t hash = (static_cast<uint64_t>(groupId) << 32) | itemId;
+
+        // spread the bits over the whole hash, because the ids are small and dense
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    /**
+     * @brief combine the hashes of group- and item-name
+     */
+    static uint64_t
+    hashNames(const std::string_view groupName,
+              const std::string_view itemName)
+    {
+        uint64_t hash = std::hash<std::string_view>()(groupName);
+        hash ^= std::hash<std::string_view>()(itemName) + 0x9e3779b97f4a7c15ull
+                + (hash << 6) + (hash >> 2);
+
+        // mix the upper bits into the lower ones, which select the slot
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    ConfigNameTable m_names;
+    std::vector<Item> m_items;
+    std::vector<Slot> m_slots;
+    std::vector<Slot> m_nameSlots;
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_REGISTRY_H
@@ -0,0 +1,363 @@
+/**
+ *  @file       config_snapshot.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include <config_snapshot.h>
+#include <config_memory_usage.h>
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief append a vector of trivial values together with its size to a binary buffer
+ */
+template<typename T>
+static void
+appendVector(std::string &output, const std::vector<T> &values)
+{
+    appendBinary(output, static_cast<uint64_t>(values.size()));
+    if(values.size() > 0) {
+        output.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+}
+
+/**
+ * @brief read a vector of trivial values, which was written by appendVector
+ */
+template<typename T>
+static bool
+readVector(const std::string &input, uint64_t &position, std::vector<T> &values)
+{
+    uint64_t numberOfValues = 0;
+    if(readBinary(input, position, numberOfValues) == false
+            || (input.size() - position) / sizeof(T) < numberOfValues)
+    {
+        return false;
+    }
+
+    values.resize(numberOfValues);
+    if(numberOfValues > 0) {
+        memcpy(values.data(), input.data() + position, numberOfValues * sizeof(T));
+    }
+    position += numberOfValues * sizeof(T);
+    return true;
+}
+
+/**
+ * @brief constructor
+ */
+ConfigSnapshot::ConfigSnapshot()
+{
+    m_arrayOffsets.push_back(0);
+}
+
+/**
+ * @brief destructor
+ */
+ConfigSnapshot::~ConfigSnapshot() {}
+
+/**
+ * @brief append new string-value
+ *
+ * @param value value to append
+ *
+ * @return index of the new value
+ */
+uint32_t
+ConfigSnapshot::appendString(const std::string &value)
+{
+    m_strings.push_back(appendToBuffer(value));
+    return m_strings.size() - 1;
+}
+
+/**
+ * @brief append new long-value
+ *
+ * @param value value to append
+ *
+ * @return index of the new value
+ */
+uint32_t
+ConfigSnapshot::appendInteger(const long value)
+{
+    m_intValues.push_back(value);
+    return m_intValues.size() - 1;
+}
+
+/**
+ * @brief append new double-value
+ *
+ * @param value value to append
+ *
+ * @return index of the new value
+ */
+uint32_t
+ConfigSnapshot::appendFloat(const double value)
+{
+    m_floatValues.push_back(value);
+    return m_floatValues.size() - 1;
+}
+
+/**
+ * @brief append new bool-value to the bitmap
+ *
+ * @param value value to append
+ *
+ * @return index of the new value
+ */
+uint32_t
+ConfigSnapshot::appendBoolean(const bool value)
+{
+    const uint32_t index = m_numberOfBooleans;
+    if(index % 64 == 0) {
+        m_boolBitmap.push_back(0);
+    }
+
+    if(value) {
+        m_boolBitmap[index / 64] |= (1ul << (index % 64));
+    }
+
+    m_numberOfBooleans++;
+    return index;
+}
+
+/**
+ * @brief append new string-array-value
+ *
+ * @param value value to append
+ *
+ * @return index of the new value
+ */
+uint32_t
+ConfigSnapshot::appendStringArray(const std::vector<std::string> &value)
+{
+    for(const std::string &element : value) {
+        m_arrayElements.push_back(appendToBuffer(element));
+    }
+
+    m_arrayOffsets.push_back(m_arrayElements.size());
+    return m_arrayOffsets.size() - 2;
+}
+
+/**
+ * @brief release all over-allocated memory after the last value was appended
+ */
+void
+ConfigSnapshot::compact()
+{
+    m_intValues.shrink_to_fit();
+    m_floatValues.shrink_to_fit();
+    m_boolBitmap.shrink_to_fit();
+    m_stringBuffer.shrink_to_fit();
+    m_strings.shrink_to_fit();
+    m_arrayOffsets.shrink_to_fit();
+    m_arrayElements.shrink_to_fit();
+    for(std::vector<uint32_t> &overrides : m_overrides) {
+        overrides.shrink_to_fit();
+    }
+}
+
+/**
+ * @brief get the heap-memory of all values of the snapshot without the values of its base
+ *
+ * @return number of allocated bytes including the payload of the strings
+ */
+uint64_t
+ConfigSnapshot::getMemoryUsage() const
+{
+    uint64_t size = getHeapSize(m_intValues)
+                    + getHeapSize(m_floatValues)
+                    + getHeapSize(m_boolBitmap)
+                    + getHeapSize(m_stringBuffer)
+                    + getHeapSize(m_strings)
+                    + getHeapSize(m_arrayOffsets)
+                    + getHeapSize(m_arrayElements);
+    for(const std::vector<uint32_t> &overrides : m_overrides) {
+        size += getHeapSize(overrides);
+    }
+
+    return size;
+}
+
+/**
+ * @brief get the heap-memory of the buffer with the payload of all strings and string-arrays
+ *
+ * @return number of allocated bytes
+ */
+uint64_t
+ConfigSnapshot::getPayloadSize() const
+{
+    return getHeapSize(m_stringBuffer);
+}
+
+/**
+ * @brief turn the snapshot into a layer on top of another snapshot
+ *
+ * @param base snapshot with the values of all items, which are not overridden by this layer
+ */
+void
+ConfigSnapshot::setBase(const ConfigSnapshot* base)
+{
+    m_base = base;
+}
+
+/**
+ * @brief mark the next value, which is appended for a type, as value of an overridden item. The
+ *        items of a type have to be overridden in ascending order of their indexes.
+ *
+ * @param type type of the item
+ * @param index index of the item within the base-snapshot
+ */
+void
+ConfigSnapshot::addOverride(const ConfigHandler::ConfigType type,
+                            const uint32_t index)
+{
+    m_overrides[type].push_back(index);
+}
+
+/**
+ * @brief append all values in binary form to a buffer
+ *
+ * @param output buffer, where the values should be appended
+ */
+void
+ConfigSnapshot::serialize(std::string &output) const
+{
+    appendBinary(output, m_numberOfBooleans);
+    appendVector(output, m_intValues);
+    appendVector(output, m_floatValues);
+    appendVector(output, m_boolBitmap);
+    appendVector(output, m_strings);
+    appendVector(output, m_arrayOffsets);
+    appendVector(output, m_arrayElements);
+
+    appendBinary(output, static_cast<uint64_t>(m_stringBuffer.size()));
+    output.append(m_stringBuffer);
+}
+
+/**
+ * @brief restore all values from a buffer, which was written by the serialize-method. The buffer
+ *        comes from a file, so every size and position is checked before it is used.
+ *
+ * @param input buffer with the serialized values
+ * @param position position of the serialized values within the buffer, which is moved behind
+ *                 the values after a successful read
+ *
+ * @return false, if the buffer is too short or inconsistent, else true
+ */
+bool
+ConfigSnapshot::deserialize(const std::string &input, uint64_t &position)
+{
+    uint64_t bufferSize = 0;
+    if(readBinary(input, position, m_numberOfBooleans) == false
+            || readVector(input, position, m_intValues) == false
+            || readVector(input, position, m_floatValues) == false
+            || readVector(input, position, m_boolBitmap) == false
+            || readVector(input, position, m_strings) == false
+            || readVector(input, position, m_arrayOffsets) == false
+            || readVector(input, position, m_arrayElements) == false
+            || readBinary(input, position, bufferSize) == false
+            || input.size() - position < bufferSize)
+    {
+        return false;
+    }
+
+    m_stringBuffer.assign(input.data() + position, bufferSize);
+    position += bufferSize;
+
+    // check consistency of bitmap and string-positions
+    if(m_boolBitmap.size() != (m_numberOfBooleans + 63) / 64
+            || checkStringRefs(m_strings) == false
+            || checkStringRefs(m_arrayElements) == false
+            || m_arrayOffsets.size() == 0
+            || m_arrayOffsets[0] != 0
+            || m_arrayOffsets.back() != m_arrayElements.size())
+    {
+        return false;
+    }
+
+    for(uint32_t i = 1; i < m_arrayOffsets.size(); i++)
+    {
+        if(m_arrayOffsets[i] < m_arrayOffsets[i - 1]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief get string-array-value
+ *
+ * @param index index of the value
+ *
+ * @return copy of the string-array
+ */
+const std::vector<std::string>
+ConfigSnapshot::getStringArray(uint32_t index) const
+{
+    if(m_base != nullptr)
+    {
+        const uint32_t position = findOverride(ConfigHandler::STRING_ARRAY_TYPE, index);
+        if(position == NO_CONFIG_OVERRIDE) {
+            return m_base->getStringArray(index);
+        }
+        index = position;
+    }
+
+    std::vector<std::string> result;
+
+    const uint32_t begin = m_arrayOffsets[index];
+    const uint32_t end = m_arrayOffsets[index + 1];
+    result.reserve(end - begin);
+    for(uint32_t i = begin; i < end; i++)
+    {
+        const ConfigStringRef &ref = m_arrayElements[i];
+        result.emplace_back(&m_stringBuffer[ref.offset], ref.size);
+    }
+
+    return result;
+}
+
+/**
+ * @brief check if all string-positions are within the string-buffer
+ *
+ * @param refs string-positions to check
+ *
+ * @return true, if all positions are valid, else false
+ */
+bool
+ConfigSnapshot::checkStringRefs(const std::vector<ConfigStringRef> &refs) const
+{
+    for(const ConfigStringRef &ref : refs)
+    {
+        if(static_cast<uint64_t>(ref.offset) + ref.size > m_stringBuffer.size()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief append string-payload to the buffer
+ *
+ * @param value string to append
+ *
+ * @return position of the string within the buffer
+ */
+ConfigStringRef
+ConfigSnapshot::appendToBuffer(const std::string &value)
+{
+    ConfigStringRef ref;
+    ref.offset = m_stringBuffer.size();
+    ref.size = value.size();
+    m_stringBuffer.append(value);
+    return ref;
+}
+
+} // namespace Kitsunemimi
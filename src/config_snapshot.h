@@ -0,0 +1,243 @@
+/**
+ *  @file       config_snapshot.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_SNAPSHOT_H
+#define CONFIG_SNAPSHOT_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <stdint.h>
+
+#include <libKitsunemimiConfig/config_handler.h>
+#include <libKitsunemimiConfig/string_array_view.h>
+
+#define NO_CONFIG_OVERRIDE 0xFFFFFFFF
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief append the raw bytes of a trivial value to a binary buffer
+ */
+template<typename T>
+inline void
+appendBinary(std::string &output, const T &value)
+{
+    output.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief read a trivial value from a binary buffer and move the position behind it
+ *
+ * @return false, if the buffer is too short, else true
+ */
+template<typename T>
+inline bool
+readBinary(const std::string &input, uint64_t &position, T &value)
+{
+    if(input.size() < position
+            || input.size() - position < sizeof(T))
+    {
+        return false;
+    }
+
+    memcpy(&value, input.data() + position, sizeof(T));
+    position += sizeof(T);
+    return true;
+}
+
+/**
+ * @brief storage for the pre-converted values of all registered items. All values are stored
+ *        in contiguous arrays per type, boolean values as bitmap and the payload of all strings
+ *        and string-arrays within one single buffer. The position of a value within the array
+ *        of its type is the index of the handle of the item.
+ *
+ *        A snapshot can also be a layer on top of a base-snapshot, which holds only the values of
+ *        the overridden items. All other values are read from the base-snapshot, which must exist
+ *        as long as the layer.
+ */
+class ConfigSnapshot
+{
+public:
+    ConfigSnapshot();
+    ~ConfigSnapshot();
+
+    uint32_t appendString(const std::string &value);
+    uint32_t appendInteger(const long value);
+    uint32_t appendFloat(const double value);
+    uint32_t appendBoolean(const bool value);
+    uint32_t appendStringArray(const std::vector<std::string> &value);
+
+    void compact();
+    uint64_t getMemoryUsage() const;
+    uint64_t getPayloadSize() const;
+
+    void setBase(const ConfigSnapshot* base);
+    void addOverride(const ConfigHandler::ConfigType type, const uint32_t index);
+
+    void serialize(std::string &output) const;
+    bool deserialize(const std::string &input, uint64_t &position);
+
+    uint32_t numberOfStrings() const
+    {
+        return m_base ? m_base->numberOfStrings() : m_strings.size();
+    }
+    uint32_t numberOfIntegers() const
+    {
+        return m_base ? m_base->numberOfIntegers() : m_intValues.size();
+    }
+    uint32_t numberOfFloats() const
+    {
+        return m_base ? m_base->numberOfFloats() : m_floatValues.size();
+    }
+    uint32_t numberOfBooleans() const
+    {
+        return m_base ? m_base->numberOfBooleans() : m_numberOfBooleans;
+    }
+    uint32_t numberOfStringArrays() const
+    {
+        return m_base ? m_base->numberOfStringArrays() : m_arrayOffsets.size() - 1;
+    }
+
+    const std::string
+    getString(const uint32_t index) const
+    {
+        const std::string_view value = getStringView(index);
+        return std::string(value.data(), value.size());
+    }
+
+    std::string_view
+    getStringView(uint32_t index) const
+    {
+        if(m_base != nullptr)
+        {
+            const uint32_t position = findOverride(ConfigHandler::STRING_TYPE, index);
+            if(position == NO_CONFIG_OVERRIDE) {
+                return m_base->getStringView(index);
+            }
+            index = position;
+        }
+
+        const ConfigStringRef &ref = m_strings[index];
+        return std::string_view(m_stringBuffer.data() + ref.offset, ref.size);
+    }
+
+    long
+    getInteger(uint32_t index) const
+    {
+        if(m_base != nullptr)
+        {
+            const uint32_t position = findOverride(ConfigHandler::INT_TYPE, index);
+            if(position == NO_CONFIG_OVERRIDE) {
+                return m_base->getInteger(index);
+            }
+            index = position;
+        }
+
+        return m_intValues[index];
+    }
+
+    double
+    getFloat(uint32_t index) const
+    {
+        if(m_base != nullptr)
+        {
+            const uint32_t position = findOverride(ConfigHandler::FLOAT_TYPE, index);
+            if(position == NO_CONFIG_OVERRIDE) {
+                return m_base->getFloat(index);
+            }
+            index = position;
+        }
+
+        return m_floatValues[index];
+    }
+
+    bool
+    getBoolean(uint32_t index) const
+    {
+        if(m_base != nullptr)
+        {
+            const uint32_t position = findOverride(ConfigHandler::BOOL_TYPE, index);
+            if(position == NO_CONFIG_OVERRIDE) {
+                return m_base->getBoolean(index);
+            }
+            index = position;
+        }
+
+        return (m_boolBitmap[index / 64] >> (index % 64)) & 1;
+    }
+
+    const std::vector<std::string> getStringArray(uint32_t index) const;
+
+    StringArrayView
+    getStringArrayView(uint32_t index) const
+    {
+        if(m_base != nullptr)
+        {
+            const uint32_t position = findOverride(ConfigHandler::STRING_ARRAY_TYPE, index);
+            if(position == NO_CONFIG_OVERRIDE) {
+                return m_base->getStringArrayView(index);
+            }
+            index = position;
+        }
+
+        const uint32_t begin = m_arrayOffsets[index];
+        return StringArrayView(m_stringBuffer.data(),
+                               m_arrayElements.data() + begin,
+                               m_arrayOffsets[index + 1] - begin);
+    }
+
+private:
+    /**
+     * @brief get the position of the value of an overridden item within this layer
+     *
+     * @return NO_CONFIG_OVERRIDE, if the item is not overridden, else position of the value
+     */
+    uint32_t
+    findOverride(const ConfigHandler::ConfigType type, const uint32_t index) const
+    {
+        const std::vector<uint32_t> &overrides = m_overrides[type];
+        const auto it = std::lower_bound(overrides.begin(), overrides.end(), index);
+        if(it == overrides.end()
+                || *it != index)
+        {
+            return NO_CONFIG_OVERRIDE;
+        }
+
+        return it - overrides.begin();
+    }
+
+    bool checkStringRefs(const std::vector<ConfigStringRef> &refs) const;
+    ConfigStringRef appendToBuffer(const std::string &value);
+
+    std::vector<long> m_intValues;
+    std::vector<double> m_floatValues;
+    std::vector<uint64_t> m_boolBitmap;
+    uint32_t m_numberOfBooleans = 0;
+
+    // payload of all strings and string-arrays
+    std::string m_stringBuffer;
+    std::vector<ConfigStringRef> m_strings;
+
+    // the elements of string-array n are the elements from m_arrayOffsets[n]
+    // until m_arrayOffsets[n + 1] within m_arrayElements
+    std::vector<uint32_t> m_arrayOffsets;
+    std::vector<ConfigStringRef> m_arrayElements;
+
+    // only used by layers: indexes of the overridden items per type in ascending order. The n-th
+    // index belongs to the n-th value of the type within this layer.
+    const ConfigSnapshot* m_base = nullptr;
+    std::vector<uint32_t> m_overrides[ConfigHandler::STRING_ARRAY_TYPE + 1];
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_SNAPSHOT_H
@@ -0,0 +1,1044 @@
+/**
+ *  @file       config_sources.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include <libKitsunemimiConfig/config_handler.h>
+#include <config_cache.h>
+
+#include <libKitsunemimiCommon/items/data_items.h>
+#include <libKitsunemimiCommon/files/text_file.h>
+#include <libKitsunemimiIni/ini_item.h>
+
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cctype>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fnmatch.h>
+#include <ctime>
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief run a function for a number of independent jobs on a limited number of threads. The
+ *        calling thread works on the jobs too, so no thread is created for a single thread.
+ *
+ * @param numberOfJobs number of jobs
+ * @param numberOfThreads maximum number of threads including the calling thread
+ * @param function function, which is called with the index of each job exactly once
+ */
+template<typename FUNC>
+static void
+runParallel(const uint64_t numberOfJobs,
+            const uint32_t numberOfThreads,
+            FUNC function)
+{
+    std::atomic<uint64_t> nextJob {0};
+    auto worker = [&]()
+    {
+        for(uint64_t job = nextJob++; job < numberOfJobs; job = nextJob++) {
+            function(job);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const uint64_t numberOfWorkers = std::min<uint64_t>(numberOfThreads, numberOfJobs);
+    for(uint64_t i = 1; i < numberOfWorkers; i++) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+    for(std::thread &thread : threads) {
+        thread.join();
+    }
+}
+
+/**
+ * @brief read the content of all sources in the order of their precedence. Each override is
+ *        converted into a small config-file with only one value, so it is parsed and checked
+ *        exactly like a value of a config-file.
+ *
+ * @param contents reference for the resulting content of the sources
+ * @param error reference for error-output
+ *
+ * @return false, if a file can not be read or an override is invalid, else true
+ */
+bool
+ConfigHandler::readSources(std::vector<SourceContent> &contents,
+                           ErrorContainer &error)
+{
+    contents.clear();
+
+    // read files together with their included files. Files, which are added directly, are
+    // read together first, so they can be read in parallel.
+    std::vector<std::string> includeStack;
+    std::set<std::string> usedFragments;
+    std::vector<std::string> filePaths;
+    for(const std::string &filePath : m_sources->filePaths)
+    {
+        if(isIncludeDirectory(filePath) == false) {
+            filePaths.push_back(filePath);
+        }
+    }
+    prefetchFragments(filePaths, usedFragments);
+
+    for(const std::string &filePath : m_sources->filePaths)
+    {
+        bool result = false;
+        if(isIncludeDirectory(filePath)) {
+            result = readIncludeDirectory(filePath, contents, includeStack, usedFragments, error);
+        }
+        else {
+            result = readFragment(filePath, "", contents, includeStack, usedFragments, error);
+        }
+
+        if(result == false) {
+            return false;
+        }
+    }
+
+    // forget files, which are not included anymore
+    for(auto it = m_fragments.begin(); it != m_fragments.end();)
+    {
+        if(usedFragments.count(it->first) == 0) {
+            it = m_fragments.erase(it);
+        }
+        else {
+            it++;
+        }
+    }
+
+    return appendOverrides(contents, error);
+}
+
+/**
+ * @brief read a config-file and all files, which are included by it. The included files follow
+ *        directly after the including file in the order of their include-directives, so they
+ *        override its values. The files of an include-directory are sorted by their names. The
+ *        content of a file is only read again, if the file has changed since the last read.
+ *
+ * @param filePath path of the config-file
+ * @param includeDirectory pattern of the include-directory, which contains the file, or empty
+ *                         string, if the file was added or included directly
+ * @param contents reference for the resulting content of the sources
+ * @param includeStack files, which are currently read, to detect include-cycles
+ * @param usedFragments reference for the paths of all read files
+ * @param error reference for error-output
+ *
+ * @return false, if a file can not be read or an include-cycle exist, else true
+ */
+bool
+ConfigHandler::readFragment(const std::string &filePath,
+                            const std::string &includeDirectory,
+                            std::vector<SourceContent> &contents,
+                            std::vector<std::string> &includeStack,
+                            std::set<std::string> &usedFragments,
+                            ErrorContainer &error)
+{
+    if(std::find(includeStack.begin(), includeStack.end(), filePath) != includeStack.end())
+    {
+        error.addMeesage("Error while reading config-file \"" + filePath + "\" "
+                         "because it includes itself");
+        return false;
+    }
+
+    // files, which were already read by the prefetch, are not checked again
+    ConfigFragment &fragment = m_fragments[filePath];
+    if(usedFragments.count(filePath) == 0
+            && refreshFragment(filePath, fragment, error) == false)
+    {
+        m_fragments.erase(filePath);
+        error.addMeesage("Error while reading config-file \"" + filePath + "\"");
+        return false;
+    }
+    usedFragments.insert(filePath);
+
+    SourceContent sourceContent;
+    sourceContent.source = FILE_SOURCE;
+    sourceContent.origin = filePath;
+    sourceContent.content = fragment.content;
+    sourceContent.includeDirectory = includeDirectory;
+    sourceContent.groupHashes = fragment.groupHashes;
+    contents.push_back(std::move(sourceContent));
+
+    // relative paths of includes are relative to the directory of the including file
+    const std::vector<std::pair<std::string, std::string>> includes = fragment.includes;
+    const size_t separator = filePath.rfind('/');
+    const std::string directory = separator == std::string::npos
+                                  ? ""
+                                  : filePath.substr(0, separator + 1);
+
+    includeStack.push_back(filePath);
+    for(const auto& [directive, value] : includes)
+    {
+        const std::string path = value[0] == '/' ? value : directory + value;
+        if(directive == "include")
+        {
+            if(readFragment(path, "", contents, includeStack, usedFragments, error) == false) {
+                return false;
+            }
+            continue;
+        }
+
+        if(readIncludeDirectory(path, contents, includeStack, usedFragments, error) == false)
+        {
+            error.addMeesage("Error while reading include-directory of config-file \""
+                             + filePath + "\"");
+            return false;
+        }
+    }
+    includeStack.pop_back();
+
+    return true;
+}
+
+/**
+ * @brief read all config-files of an include-directory in the order of their names. The files
+ *        are read in parallel first and afterwards added in their order together with the files,
+ *        which they include.
+ *
+ * @param pattern directory with an optional pattern for the file-names
+ * @param contents reference for the resulting content of the sources
+ * @param includeStack files, which are currently read, to detect include-cycles
+ * @param usedFragments reference for the paths of all read files
+ * @param error reference for error-output
+ *
+ * @return false, if the directory or a file can not be read, else true
+ */
+bool
+ConfigHandler::readIncludeDirectory(const std::string &pattern,
+                                    std::vector<SourceContent> &contents,
+                                    std::vector<std::string> &includeStack,
+                                    std::set<std::string> &usedFragments,
+                                    ErrorContainer &error)
+{
+    std::vector<std::string> filePaths;
+    if(listIncludeDirectory(pattern, filePaths, error) == false) {
+        return false;
+    }
+
+    prefetchFragments(filePaths, usedFragments);
+    for(const std::string &filePath : filePaths)
+    {
+        if(readFragment(filePath, pattern, contents, includeStack, usedFragments, error) == false) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief read multiple config-files in parallel into the cache of the files. Files, which fail,
+ *        are not marked as read, so they are read again in the normal order, which creates the
+ *        same error-messages like without prefetch.
+ *
+ * @param filePaths paths of the config-files
+ * @param usedFragments reference for the paths of all read files
+ */
+void
+ConfigHandler::prefetchFragments(const std::vector<std::string> &filePaths,
+                                 std::set<std::string> &usedFragments)
+{
+    const uint32_t numberOfThreads = getNumberOfThreads();
+    if(numberOfThreads <= 1
+            || filePaths.size() <= 1)
+    {
+        return;
+    }
+
+    // each file is read only once, because a file, which is listed multiple times, would be
+    // written by multiple threads at the same time
+    std::set<std::string> knownPaths;
+    std::vector<const std::string*> uniquePaths;
+    for(const std::string &filePath : filePaths)
+    {
+        if(usedFragments.count(filePath) == 0
+                && knownPaths.insert(filePath).second)
+        {
+            uniquePaths.push_back(&filePath);
+        }
+    }
+
+    // entries are created before, because the map itself can not be changed by multiple threads
+    std::vector<ConfigFragment*> fragments;
+    std::vector<uint8_t> results(uniquePaths.size(), 0);
+    for(const std::string* filePath : uniquePaths) {
+        fragments.push_back(&m_fragments[*filePath]);
+    }
+
+    runParallel(uniquePaths.size(), numberOfThreads, [&](const uint64_t i)
+    {
+        ErrorContainer fragmentError;
+        results[i] = refreshFragment(*uniquePaths[i], *fragments[i], fragmentError);
+    });
+
+    for(uint64_t i = 0; i < uniquePaths.size(); i++)
+    {
+        if(results[i]) {
+            usedFragments.insert(*uniquePaths[i]);
+        }
+    }
+}
+
+/**
+ * @brief get the number of threads for reading and parsing of the config-files
+ *
+ * @return number of threads, which is at least 1
+ */
+uint32_t
+ConfigHandler::getNumberOfThreads() const
+{
+    if(m_sources == nullptr) {
+        return 1;
+    }
+
+    uint32_t numberOfThreads = m_sources->numberOfThreads;
+    if(numberOfThreads == 0) {
+        numberOfThreads = std::thread::hardware_concurrency();
+    }
+
+    return std::max(numberOfThreads, 1u);
+}
+
+/**
+ * @brief read a config-file again, if it has changed since the last read. Different fragments can
+ *        be refreshed by different threads at the same time.
+ *
+ * @param filePath path of the config-file
+ * @param fragment cached content of the file
+ * @param error reference for error-output
+ *
+ * @return false, if the file can not be read, else true
+ */
+bool
+ConfigHandler::refreshFragment(const std::string &filePath,
+                               ConfigFragment &fragment,
+                               ErrorContainer &error)
+{
+    // the time is taken before the file is checked, so a change in the same moment as the read
+    // is not missed
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    const int64_t readTime = now.tv_sec * 1000000000ll + now.tv_nsec;
+
+    struct stat fileStat;
+    if(stat(filePath.c_str(), &fileStat) != 0)
+    {
+        error.addMeesage("Failed to open file \"" + filePath + "\"");
+        return false;
+    }
+    const int64_t modificationTime = fileStat.st_mtim.tv_sec * 1000000000ll
+                                     + fileStat.st_mtim.tv_nsec;
+
+    // a file, which was changed shortly before the last read, could have been changed again
+    // without a new modification-time, because of the resolution of the timestamps
+    if(fragment.readTime != 0
+            && fragment.modificationTime == modificationTime
+            && fragment.size == static_cast<uint64_t>(fileStat.st_size)
+            && fragment.inode == static_cast<uint64_t>(fileStat.st_ino)
+            && fragment.modificationTime + 1000000000ll <= fragment.readTime)
+    {
+        return true;
+    }
+
+    std::string content = "";
+    if(readConfigFile(content, filePath, error) == false) {
+        return false;
+    }
+
+    fragment.content = extractIncludes(content, fragment.includes);
+    hashGroups(fragment.content, fragment.groupHashes);
+    fragment.modificationTime = modificationTime;
+    fragment.readTime = readTime;
+    fragment.size = fileStat.st_size;
+    fragment.inode = fileStat.st_ino;
+
+    return true;
+}
+
+/**
+ * @brief check if a path of a config-source is a directory or a pattern for files of a directory
+ *
+ * @param path path to check
+ *
+ * @return true, if the last part of the path has a wildcard or the path is a directory
+ */
+bool
+ConfigHandler::isIncludeDirectory(const std::string &path)
+{
+    const size_t separator = path.rfind('/');
+    const size_t nameStart = separator == std::string::npos ? 0 : separator + 1;
+    if(path.find_first_of("*?[", nameStart) != std::string::npos) {
+        return true;
+    }
+
+    struct stat fileStat;
+    return stat(path.c_str(), &fileStat) == 0 && S_ISDIR(fileStat.st_mode);
+}
+
+/**
+ * @brief remove the include-directives from the content of a config-file. Directives are only
+ *        allowed before the first group and have the form 'include = path' or
+ *        'include_dir = directory/pattern' with a pattern like '*.ini' for the file-names.
+ *
+ * @param content content of the config-file
+ * @param includes reference for the directives and their paths in the order of the file
+ *
+ * @return content of the config-file without the include-directives
+ */
+const std::string
+ConfigHandler::extractIncludes(const std::string &content,
+                               std::vector<std::pair<std::string, std::string>> &includes)
+{
+    includes.clear();
+    std::string result = "";
+    uint64_t pos = 0;
+
+    while(pos < content.size())
+    {
+        uint64_t lineEnd = content.find('\n', pos);
+        lineEnd = (lineEnd == std::string::npos) ? content.size() : lineEnd + 1;
+
+        // directives end at the first group
+        const uint64_t first = content.find_first_not_of(" \t", pos);
+        if(first < lineEnd
+                && content[first] == '[')
+        {
+            break;
+        }
+
+        std::string line = content.substr(pos, lineEnd - pos);
+        const size_t separator = line.find('=');
+        std::string name = "";
+        std::string value = "";
+        if(separator != std::string::npos)
+        {
+            name = line.substr(0, separator);
+            value = line.substr(separator + 1);
+            name.erase(0, name.find_first_not_of(" \t"));
+            name.erase(name.find_last_not_of(" \t") + 1);
+            value.erase(0, value.find_first_not_of(" \t"));
+            value.erase(value.find_last_not_of(" \t\r\n") + 1);
+            if(value.size() >= 2
+                    && value.front() == '\"'
+                    && value.back() == '\"')
+            {
+                value = value.substr(1, value.size() - 2);
+            }
+        }
+
+        if((name == "include" || name == "include_dir")
+                && value.size() > 0)
+        {
+            includes.emplace_back(name, value);
+        }
+        else
+        {
+            result.append(line);
+        }
+
+        pos = lineEnd;
+    }
+
+    result.append(content, pos, std::string::npos);
+    return result;
+}
+
+/**
+ * @brief list all files of an include-directory, which match the pattern of the include-directive
+ *
+ * @param pattern directory with a pattern for the file-names like '*.ini' as last part of the
+ *                path. If the last part has no wildcard, it is the directory itself and all files
+ *                with the ending '.ini' are used.
+ * @param filePaths reference for the paths of the matching files, sorted by their names
+ * @param error reference for error-output
+ *
+ * @return false, if the directory can not be opened, else true
+ */
+bool
+ConfigHandler::listIncludeDirectory(const std::string &pattern,
+                                    std::vector<std::string> &filePaths,
+                                    ErrorContainer &error)
+{
+    std::string directory = pattern;
+    std::string filePattern = "*.ini";
+    const size_t separator = pattern.rfind('/');
+    if(separator != std::string::npos
+            && pattern.find_first_of("*?[", separator) != std::string::npos)
+    {
+        directory = pattern.substr(0, separator);
+        filePattern = pattern.substr(separator + 1);
+    }
+
+    DIR* dir = opendir(directory.c_str());
+    if(dir == nullptr)
+    {
+        error.addMeesage("Failed to open include-directory \"" + directory + "\"");
+        return false;
+    }
+
+    // hidden files like backups of editors are never included
+    filePaths.clear();
+    while(struct dirent* entry = readdir(dir))
+    {
+        if(fnmatch(filePattern.c_str(), entry->d_name, FNM_PERIOD) != 0) {
+            continue;
+        }
+
+        const std::string filePath = directory + "/" + entry->d_name;
+        struct stat fileStat;
+        if(stat(filePath.c_str(), &fileStat) == 0
+                && S_ISREG(fileStat.st_mode))
+        {
+            filePaths.push_back(filePath);
+        }
+    }
+    closedir(dir);
+
+    std::sort(filePaths.begin(), filePaths.end());
+
+    return true;
+}
+
+/**
+ * @brief restore the content of all sources of the initialization without reading the files
+ *        again. The overrides are converted again, because the environment-variables of items,
+ *        which were registered since then, are added to them.
+ *
+ * @param contents reference for the resulting content of the sources
+ * @param error reference for error-output
+ *
+ * @return false, if an override is invalid, else true
+ */
+bool
+ConfigHandler::restoreSources(std::vector<SourceContent> &contents,
+                              ErrorContainer &error)
+{
+    // the content is released, when the config is sealed
+    if(m_sourceContents.size() == 0) {
+        return readSources(contents, error);
+    }
+
+    contents.clear();
+    for(const SourceContent &sourceContent : m_sourceContents)
+    {
+        if(sourceContent.source == FILE_SOURCE) {
+            contents.push_back(sourceContent);
+        }
+    }
+
+    return appendOverrides(contents, error);
+}
+
+/**
+ * @brief convert all overrides and the environment-variables of the registered items in the
+ *        order of their precedence into sources and append them
+ *
+ * @param contents reference for the resulting content of the sources
+ * @param error reference for error-output
+ *
+ * @return false, if an override is invalid, else true
+ */
+bool
+ConfigHandler::appendOverrides(std::vector<SourceContent> &contents,
+                               ErrorContainer &error)
+{
+    std::vector<ConfigOverride> overrides = m_sources->overrides;
+    for(const auto& [name, key] : m_environmentNames)
+    {
+        const auto variable = m_environment.find(name);
+        if(variable == m_environment.end()) {
+            continue;
+        }
+
+        ConfigOverride configOverride;
+        configOverride.source = ENVIRONMENT_SOURCE;
+        configOverride.origin = name;
+        configOverride.groupName = key.first;
+        configOverride.itemName = key.second;
+        configOverride.value = variable->second;
+        overrides.push_back(configOverride);
+    }
+
+    // sort overrides by their precedence and keep the order of overrides with the same precedence
+    std::stable_sort(overrides.begin(),
+                     overrides.end(),
+                     [](const ConfigOverride &a, const ConfigOverride &b) {
+                         return a.source < b.source;
+                     });
+
+    for(const ConfigOverride &configOverride : overrides)
+    {
+        SourceContent sourceContent;
+        if(createOverrideContent(configOverride, sourceContent, error) == false) {
+            return false;
+        }
+        contents.push_back(std::move(sourceContent));
+    }
+
+    return true;
+}
+
+/**
+ * @brief convert an override into a small config-file with only one value, so it is parsed and
+ *        checked exactly like a value of a config-file
+ *
+ * @param configOverride override to convert
+ * @param sourceContent reference for the resulting source
+ * @param error reference for error-output
+ *
+ * @return false, if the override can not be written as config-file, else true
+ */
+bool
+ConfigHandler::createOverrideContent(const ConfigOverride &configOverride,
+                                     SourceContent &sourceContent,
+                                     ErrorContainer &error)
+{
+    const std::string groupName = configOverride.groupName.size() == 0
+                                  ? "DEFAULT"
+                                  : configOverride.groupName;
+    const std::string &itemName = configOverride.itemName;
+    const std::string &value = configOverride.value;
+    if(itemName.size() == 0
+            || groupName.find_first_of("[]\n") != std::string::npos
+            || itemName.find_first_of("=\n") != std::string::npos
+            || value.find('\n') != std::string::npos)
+    {
+        error.addMeesage("Invalid config-override \"" + configOverride.origin + "\": \n"
+                         "    group: \'" + groupName + "\'\n"
+                         "    item: \'" + itemName + "\'");
+        return false;
+    }
+
+    sourceContent.source = configOverride.source;
+    sourceContent.origin = configOverride.origin;
+    sourceContent.content = "[" + groupName + "]\n" + itemName + " = " + value + "\n";
+
+    return true;
+}
+
+/**
+ * @brief read all environment-variables with the environment-prefix of the sources. This is done
+ *        only once, so the registration only has to look up the mapped names.
+ */
+void
+ConfigHandler::readEnvironment()
+{
+    m_environment.clear();
+    if(m_sources->environmentPrefix.size() == 0) {
+        return;
+    }
+
+    const std::string prefix = m_sources->environmentPrefix + "_";
+    for(char** variable = environ; *variable != nullptr; variable++)
+    {
+        const std::string_view definition(*variable);
+        const size_t separator = definition.find('=');
+        if(separator == std::string_view::npos
+                || definition.compare(0, prefix.size(), prefix) != 0)
+        {
+            continue;
+        }
+
+        m_environment.emplace(std::string(definition.substr(0, separator)),
+                              std::string(definition.substr(separator + 1)));
+    }
+}
+
+/**
+ * @brief map a registered item to the name of its environment-variable. If another item has
+ *        already the same name, the name stays with the first item and a warning is logged.
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ *
+ * @return name of the environment-variable, or empty string, if the environment is not used or
+ *         the name belongs to another item
+ */
+const std::string
+ConfigHandler::mapEnvironmentName(const std::string &groupName,
+                                  const std::string &itemName)
+{
+    if(m_sources == nullptr
+            || m_sources->environmentPrefix.size() == 0)
+    {
+        return "";
+    }
+
+    const std::string name = getEnvironmentName(m_sources->environmentPrefix,
+                                                groupName,
+                                                itemName);
+    const auto result = m_environmentNames.emplace(name, std::make_pair(groupName, itemName));
+    const std::pair<std::string, std::string> &key = result.first->second;
+    if(key.first != groupName
+            || key.second != itemName)
+    {
+        LOG_WARNING("environment-variable \"" + name + "\" is already used by: \n"
+                    "    group: \'" + key.first + "\'\n"
+                    "    item: \'" + key.second + "\'");
+        return "";
+    }
+
+    return name;
+}
+
+/**
+ * @brief map a new registered item to its environment-variable and merge the value of the
+ *        variable into the parsed sources, so it is checked like the value of a config-file.
+ *        Values of the command-line are not replaced, because they have a higher precedence.
+ *        While the values are taken from the cache, the variable is only mapped, because the
+ *        cached values already contain the environment.
+ *
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ * @param error reference for error-output
+ *
+ * @return false, if the value of the variable is invalid, else true
+ */
+bool
+ConfigHandler::applyEnvironment(const std::string &groupName,
+                                const std::string &itemName,
+                                ErrorContainer &error)
+{
+    const std::string name = mapEnvironmentName(groupName, itemName);
+    if(name.size() == 0
+            || m_iniItem == nullptr)
+    {
+        return true;
+    }
+
+    const auto variable = m_environment.find(name);
+    if(variable == m_environment.end()) {
+        return true;
+    }
+
+    const auto group = m_valueOrigins.find(groupName);
+    if(group != m_valueOrigins.end())
+    {
+        const auto item = group->second.find(itemName);
+        if(item != group->second.end()
+                && item->second.source > ENVIRONMENT_SOURCE)
+        {
+            return true;
+        }
+    }
+
+    ConfigOverride configOverride;
+    configOverride.source = ENVIRONMENT_SOURCE;
+    configOverride.origin = name;
+    configOverride.groupName = groupName;
+    configOverride.itemName = itemName;
+    configOverride.value = variable->second;
+
+    std::vector<SourceContent> contents(1);
+    return createOverrideContent(configOverride, contents[0], error)
+           && parseSources(contents, nullptr, *m_iniItem, m_valueOrigins, error);
+}
+
+/**
+ * @brief get the name of the environment-variable of an item
+ *
+ * @param prefix environment-prefix of the sources
+ * @param groupName name of the group
+ * @param itemName name of the item within the group
+ *
+ * @return '<PREFIX>_<GROUP>_<ITEM>' in upper-case, where all characters other than letters and
+ *         digits are replaced by '_'
+ */
+const std::string
+ConfigHandler::getEnvironmentName(const std::string &prefix,
+                                  const std::string &groupName,
+                                  const std::string &itemName)
+{
+    std::string name = prefix + "_" + groupName + "_" + itemName;
+    for(char &character : name)
+    {
+        const unsigned char value = static_cast<unsigned char>(character);
+        if(std::isalnum(value)) {
+            character = static_cast<char>(std::toupper(value));
+        }
+        else {
+            character = '_';
+        }
+    }
+
+    return name;
+}
+
+/**
+ * @brief parse the content of all sources and merge them into one parsed config-file
+ *
+ * @param contents content of the sources in the order of their precedence
+ * @param groupNames optional names of groups, which should be parsed. All other groups are
+ *                   skipped. If nullptr, all groups are parsed.
+ * @param iniItem reference for the merged result
+ * @param origins reference for the sources of all parsed values
+ * @param error reference for error-output
+ *
+ * @return false, if a source can not be parsed, else true
+ */
+bool
+ConfigHandler::parseSources(const std::vector<SourceContent> &contents,
+                            const std::set<std::string>* groupNames,
+                            IniItem &iniItem,
+                            ValueOrigins &origins,
+                            ErrorContainer &error)
+{
+    // cutting out the requested groups is independent for each source and can run on the
+    // threads. The parsing itself stays on the calling thread, because the parser of
+    // libKitsunemimiIni is a process-wide instance around a non-reentrant scanner.
+    std::vector<std::string> partialContents(contents.size());
+    if(groupNames != nullptr)
+    {
+        runParallel(contents.size(), getNumberOfThreads(), [&](const uint64_t i) {
+            partialContents[i] = extractGroups(contents[i].content, *groupNames);
+        });
+    }
+
+    // parse and merge the sources in the order of their precedence
+    for(uint64_t i = 0; i < contents.size(); i++)
+    {
+        const SourceContent &sourceContent = contents[i];
+        if(groupNames != nullptr
+                && partialContents[i].size() == 0)
+        {
+            continue;
+        }
+
+        IniItem sourceItem;
+        if(sourceItem.parse(groupNames ? partialContents[i] : sourceContent.content,
+                            error) == false)
+        {
+            error.addMeesage("Error while parsing config-source \"" + sourceContent.origin + "\"");
+            return false;
+        }
+
+        mergeIniItem(iniItem, sourceItem, sourceContent, origins);
+    }
+
+    return true;
+}
+
+/**
+ * @brief load the sources of the current values, which were not loaded, because the values were
+ *        taken from the cache
+ *
+ * @return false, if the sources can not be parsed anymore, else true
+ */
+bool
+ConfigHandler::loadValueOrigins()
+{
+    ErrorContainer error;
+    std::vector<SourceContent> contents;
+    if(restoreSources(contents, error) == false)
+    {
+        LOG_ERROR(error);
+        return false;
+    }
+
+    IniItem iniItem;
+    m_valueOrigins.clear();
+    if(parseSources(contents, nullptr, iniItem, m_valueOrigins, error) == false)
+    {
+        LOG_ERROR(error);
+        return false;
+    }
+
+    m_valueOriginsLoaded = true;
+    return true;
+}
+
+/**
+ * @brief move all values of a parsed source into the merged config. Values of the target are
+ *        replaced, because the sources are merged in ascending order of their precedence.
+ *
+ * @param target merged config
+ * @param source parsed source, which is empty afterwards
+ * @param sourceContent source, to which the values belong
+ * @param origins reference for the sources of all merged values
+ */
+void
+ConfigHandler::mergeIniItem(IniItem &target,
+                            IniItem &source,
+                            const SourceContent &sourceContent,
+                            ValueOrigins &origins)
+{
+    for(auto& [groupName, sourceGroup] : source.m_content->m_map)
+    {
+        DataMap* sourceMap = sourceGroup->toMap();
+        if(sourceMap == nullptr) {
+            continue;
+        }
+
+        if(target.m_content->get(groupName) == nullptr) {
+            target.m_content->insert(groupName, new DataMap());
+        }
+        DataMap* targetMap = target.m_content->get(groupName)->toMap();
+
+        for(auto& [itemName, value] : sourceMap->m_map)
+        {
+            DataItem* &targetValue = targetMap->m_map[itemName];
+            delete targetValue;
+            targetValue = value;
+            value = nullptr;
+
+            // files of the same include-directory come from different owners, so they should
+            // not set the same items
+            ValueOrigin &origin = origins[groupName][itemName];
+            if(sourceContent.source == FILE_SOURCE
+                    && origin.source == FILE_SOURCE
+                    && sourceContent.includeDirectory.size() > 0
+                    && origin.includeDirectory == sourceContent.includeDirectory)
+            {
+                LOG_WARNING("config-item is set by multiple files of the same include-directory: \n"
+                            "    group: \'" + groupName + "\'\n"
+                            "    item: \'" + itemName + "\'\n"
+                            "    files: \'" + origin.origin + "\', "
+                            "\'" + sourceContent.origin + "\'");
+                origin.conflict = origin.origin;
+            }
+            origin.source = sourceContent.source;
+            origin.origin = sourceContent.origin;
+            origin.includeDirectory = sourceContent.includeDirectory;
+        }
+    }
+}
+
+/**
+ * @brief calculate a hash of each group over all sources. The position and origin of a source
+ *        are part of the hash, because they define the precedence and the origin of its values.
+ *
+ * @param contents content of the sources in the order of their precedence
+ * @param groupHashes reference for the resulting hashes
+ */
+void
+ConfigHandler::hashSources(const std::vector<SourceContent> &contents,
+                           std::map<std::string, uint64_t> &groupHashes)
+{
+    groupHashes.clear();
+    for(uint32_t i = 0; i < contents.size(); i++)
+    {
+        // hashes of config-files are already calculated, when the file was read
+        const SourceContent &sourceContent = contents[i];
+        std::map<std::string, uint64_t> sourceHashes;
+        if(sourceContent.source == FILE_SOURCE) {
+            sourceHashes = sourceContent.groupHashes;
+        }
+        else {
+            hashGroups(sourceContent.content, sourceHashes);
+        }
+
+        for(const auto& [groupName, sourceHash] : sourceHashes)
+        {
+            uint64_t &hash = groupHashes.emplace(groupName, CONFIG_HASH_SEED).first->second;
+            hash = ConfigCache::hashData(reinterpret_cast<const char*>(&i), sizeof(i), hash);
+            hash = ConfigCache::hashData(sourceContent.origin.c_str(),
+                                         sourceContent.origin.size() + 1,
+                                         hash);
+            hash = ConfigCache::hashData(reinterpret_cast<const char*>(&sourceHash),
+                                         sizeof(sourceHash),
+                                         hash);
+        }
+    }
+}
+
+/**
+ * @brief calculate a hash over the content of all sources for the cache. The content of a
+ *        config-file is the content without its include-directives, so even a single file has not
+ *        the hash of the file on the disk. The origins of the sources are not part of the hash,
+ *        because the cache holds only the values and the origins are resolved from the sources.
+ *
+ * @param contents content of the sources in the order of their precedence
+ *
+ * @return hash of all sources
+ */
+uint64_t
+ConfigHandler::hashSourceContents(const std::vector<SourceContent> &contents)
+{
+    // separate the sources, so moving content from one source to the next changes the hash
+    uint64_t hash = CONFIG_HASH_SEED;
+    for(uint32_t i = 0; i < contents.size(); i++)
+    {
+        if(i > 0) {
+            hash = ConfigCache::hashData("\0", 1, hash);
+        }
+        hash = ConfigCache::hashData(contents[i].content.data(), contents[i].content.size(), hash);
+    }
+
+    return hash;
+}
+
+/**
+ * @brief read the content of a config-file. The size of the file is taken once and the content
+ *        is read with a few large reads directly into the resulting string, which avoids the
+ *        line-wise reading and the intermediate buffers of a stream. A file, which is truncated
+ *        in the meantime, results in the shorter content. If the file is not a regular file,
+ *        it falls back to the normal reading of the file.
+ *
+ * @param content reference for the resulting file-content
+ * @param filePath path to the file to read
+ * @param error reference for error-output
+ *
+ * @return false, if reading the file failed, else true
+ */
+bool
+ConfigHandler::readConfigFile(std::string &content,
+                              const std::string &filePath,
+                              ErrorContainer &error)
+{
+    const int fd = open(filePath.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        error.addMeesage("Failed to open file \"" + filePath + "\"");
+        return false;
+    }
+
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) != 0
+            || S_ISREG(fileStat.st_mode) == false)
+    {
+        close(fd);
+        return readFile(content, filePath, error);
+    }
+
+    content.resize(fileStat.st_size);
+    uint64_t position = 0;
+    while(position < content.size())
+    {
+        const ssize_t numberOfBytes = read(fd, &content[position], content.size() - position);
+        if(numberOfBytes < 0)
+        {
+            if(errno == EINTR) {
+                continue;
+            }
+
+            close(fd);
+            content.clear();
+            error.addMeesage("Failed to read file \"" + filePath + "\"");
+            return false;
+        }
+
+        // end of a file, which was truncated after the size was taken
+        if(numberOfBytes == 0) {
+            break;
+        }
+
+        position += numberOfBytes;
+    }
+    content.resize(position);
+    close(fd);
+
+    return true;
+}
+
+} // namespace Kitsunemimi
@@ -2,7 +2,7 @@ QT -= qt core gui
 
 TARGET = KitsunemimiConfig
 TEMPLATE = lib
-CONFIG += c++17
+CONFIG += c++17 thread
 VERSION = 0.4.0
 
 LIBS += -L../../libKitsunemimiCommon/src -lKitsunemimiCommon
@@ -18,9 +18,27 @@ INCLUDEPATH += ../../libKitsunemimiIni/include
 INCLUDEPATH += $$PWD \
                $$PWD/../include
 
+# build with "CONFIG += config_access_stats" to count the reads of each item by the getter
+config_access_stats {
+    DEFINES += KITSUNEMIMI_CONFIG_ACCESS_STATS
+}
+
 SOURCES += \
-    config_handler.cpp
+    config_access_stats.cpp \
+    config_cache.cpp \
+    config_handler.cpp \
+    config_snapshot.cpp \
+    config_sources.cpp
 
 HEADERS += \
-    ../include/libKitsunemimiConfig/config_handler.h
+    config_access_stats.h \
+    config_cache.h \
+    config_memory_usage.h \
+    config_name_table.h \
+    config_registry.h \
+    config_snapshot.h \
+    ../include/libKitsunemimiConfig/config_binding.h \
+    ../include/libKitsunemimiConfig/config_handler.h \
+    ../include/libKitsunemimiConfig/static_config.h \
+    ../include/libKitsunemimiConfig/string_array_view.h
 
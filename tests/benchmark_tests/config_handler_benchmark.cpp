@@ -0,0 +1,547 @@
+/**
+ *  @file       config_handler_benchmark.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include "config_handler_benchmark.h"
+
+#include <libKitsunemimiConfig/config_handler.h>
+#include <libKitsunemimiCommon/files/text_file.h>
+#include <libKitsunemimiCommon/methods/file_methods.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <sys/stat.h>
+
+#ifdef KITSUNEMIMI_CONFIG_ACCESS_STATS
+#include <config_access_stats.h>
+#endif
+
+#define NUMBER_OF_ITERATIONS (1 << 20)
+#define NUMBER_OF_ARRAY_ITERATIONS (1 << 17)
+#define NUMBER_OF_REPETITIONS 7
+
+// maximum accepted costs of the access-statistics per getter-call in nanoseconds
+#define ACCESS_STATS_OVERHEAD_BOUND 100.0
+
+namespace Kitsunemimi
+{
+
+ConfigHandler_Benchmark::ConfigHandler_Benchmark()
+{
+    runSetup(10, 1);
+    runSetup(1000, 1);
+    runSetup(1000, 10);
+    runSetup(10000, 100);
+
+    benchmarkFragments(10);
+    benchmarkFragments(100);
+    benchmarkFragments(1000);
+
+    benchmarkAccessStats();
+
+    ErrorContainer error;
+    Kitsunemimi::deleteFileOrDir(m_testFilePath, error);
+    Kitsunemimi::deleteFileOrDir(m_testDirectoryPath, error);
+}
+
+/**
+ * @brief benchmark the loading of a directory with many config-files with different numbers of
+ *        threads. Each file has its own group like the config of a single service.
+ *
+ * @param numberOfFragments number of config-files in the directory
+ */
+void
+ConfigHandler_Benchmark::benchmarkFragments(const uint32_t numberOfFragments)
+{
+    ErrorContainer error;
+    Kitsunemimi::deleteFileOrDir(m_testDirectoryPath, error);
+    mkdir(m_testDirectoryPath.c_str(), 0700);
+
+    for(uint32_t i = 0; i < numberOfFragments; i++)
+    {
+        const std::string number = std::to_string(100000 + i);
+        std::string content = "[service_" + number + "]\n";
+        for(uint32_t j = 0; j < 50; j++)
+        {
+            const std::string index = std::to_string(j);
+            content += "string_" + index + " = value_" + index + "\n";
+            content += "int_" + index + " = " + index + "\n";
+        }
+        Kitsunemimi::writeFile(m_testDirectoryPath + "/" + number + ".ini", content, error, true);
+    }
+
+    double singleThreadResult = 0.0;
+    for(const uint32_t numberOfThreads : {1u, 2u, 4u, 8u})
+    {
+        std::vector<double> results;
+        for(uint32_t r = 0; r < NUMBER_OF_REPETITIONS; r++)
+        {
+            ConfigSources sources;
+            sources.addDirectory(m_testDirectoryPath);
+            sources.setNumberOfThreads(numberOfThreads);
+
+            ConfigHandler configHandler;
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            configHandler.initConfig(sources, error);
+            const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            results.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+        }
+
+        std::sort(results.begin(), results.end());
+        const double result = results[NUMBER_OF_REPETITIONS / 2];
+        if(numberOfThreads == 1) {
+            singleThreadResult = result;
+        }
+
+        printf("benchmark=loadFragments fragments=%u threads=%u ns_per_op=%.2f speedup=%.2f\n",
+               numberOfFragments,
+               numberOfThreads,
+               result,
+               singleThreadResult / result);
+        fflush(stdout);
+    }
+}
+
+/**
+ * @brief benchmark the costs, which the access-statistics add to each getter-call. Only the
+ *        instrumentation itself is measured, so the result doesn't depend on the getter and
+ *        needs no baseline of a second build. If the costs reach the bound, the whole benchmark
+ *        fails. Without "CONFIG += config_access_stats" the getter contain no instrumentation and
+ *        nothing is measured.
+ */
+void
+ConfigHandler_Benchmark::benchmarkAccessStats()
+{
+#ifdef KITSUNEMIMI_CONFIG_ACCESS_STATS
+    ConfigAccessCounters counters;
+    counters.addKey(ConfigHandler::INT_TYPE);
+
+    const double nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        ConfigAccessRecorder recorder(&counters);
+        recorder.setKey(ConfigHandler::INT_TYPE, 0);
+        return 0;
+    });
+
+    printf("benchmark=accessStats case=record iterations=%lu ns_per_op=%.2f "
+           "bound_ns=%.2f within_bound=%d\n",
+           static_cast<unsigned long>(NUMBER_OF_ITERATIONS),
+           nsPerOp,
+           ACCESS_STATS_OVERHEAD_BOUND,
+           nsPerOp < ACCESS_STATS_OVERHEAD_BOUND);
+    fflush(stdout);
+
+    if(nsPerOp >= ACCESS_STATS_OVERHEAD_BOUND)
+    {
+        fprintf(stderr, "costs of the access-statistics exceed the bound\n");
+        m_withinBounds = false;
+    }
+#endif
+}
+
+/**
+ * @brief register a number of items, which are distributed over a number of groups and all
+ *        value-types, and run all getter-benchmarks with this config
+ *
+ * @param numberOfKeys number of registered items
+ * @param numberOfGroups number of groups
+ */
+void
+ConfigHandler_Benchmark::runSetup(const uint32_t numberOfKeys,
+                                  const uint32_t numberOfGroups)
+{
+    ErrorContainer error;
+    m_numberOfKeys = numberOfKeys;
+    m_numberOfGroups = numberOfGroups;
+    Kitsunemimi::writeFile(m_testFilePath,
+                           createConfigString(numberOfKeys, numberOfGroups),
+                           error,
+                           true);
+
+    ConfigHandler configHandler;
+    if(configHandler.initConfig(m_testFilePath, error) == false)
+    {
+        LOG_ERROR(error);
+        return;
+    }
+
+    registerSingle(configHandler);
+    configHandler.sealConfig();
+
+    if(configHandler.isConfigValid() == false)
+    {
+        LOG_ERROR(error);
+        return;
+    }
+
+    benchmarkRegistration();
+    benchmarkGetString(configHandler);
+    benchmarkGetInteger(configHandler);
+    benchmarkGetFloat(configHandler);
+    benchmarkGetBoolean(configHandler);
+    benchmarkGetStringArray(configHandler);
+
+    // handle-getter without registration as reader
+    configHandler.freezeConfig();
+    bool success = false;
+    const ConfigKey<long> key = {0};
+    const double nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        return configHandler.getInteger(key, success);
+    });
+    printResult("getInteger", "frozen", NUMBER_OF_ITERATIONS, nsPerOp);
+}
+
+/**
+ * @brief benchmark registration of all items with single calls and as one schema
+ */
+void
+ConfigHandler_Benchmark::benchmarkRegistration()
+{
+    ErrorContainer error;
+    std::vector<double> singleResults;
+    std::vector<double> schemaResults;
+
+    std::vector<ConfigSpec> schema;
+    for(uint32_t type = ConfigHandler::STRING_TYPE; type < m_names.size(); type++)
+    {
+        for(const ItemName &name : m_names[type])
+        {
+            ConfigSpec spec;
+            spec.groupName = name.groupName;
+            spec.itemName = name.itemName;
+            spec.type = static_cast<ConfigHandler::ConfigType>(type);
+            schema.push_back(spec);
+        }
+    }
+
+    for(uint32_t r = 0; r < NUMBER_OF_REPETITIONS; r++)
+    {
+        ConfigHandler singleHandler;
+        singleHandler.initConfig(m_testFilePath, error);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        registerSingle(singleHandler);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        singleResults.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+
+        ConfigHandler schemaHandler;
+        schemaHandler.initConfig(m_testFilePath, error);
+        start = std::chrono::steady_clock::now();
+        schemaHandler.registerSchema(schema, error);
+        end = std::chrono::steady_clock::now();
+        schemaResults.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    std::sort(singleResults.begin(), singleResults.end());
+    std::sort(schemaResults.begin(), schemaResults.end());
+    printResult("register",
+                "single",
+                m_numberOfKeys,
+                singleResults[NUMBER_OF_REPETITIONS / 2] / m_numberOfKeys);
+    printResult("register",
+                "schema",
+                m_numberOfKeys,
+                schemaResults[NUMBER_OF_REPETITIONS / 2] / m_numberOfKeys);
+}
+
+/**
+ * @brief register all items with the register-function of their type
+ */
+void
+ConfigHandler_Benchmark::registerSingle(ConfigHandler &configHandler)
+{
+    ErrorContainer error;
+    for(uint32_t type = ConfigHandler::STRING_TYPE; type < m_names.size(); type++)
+    {
+        for(const ItemName &name : m_names[type])
+        {
+            switch(type)
+            {
+                case ConfigHandler::STRING_TYPE:
+                    configHandler.registerString(name.groupName, name.itemName, error);
+                    break;
+                case ConfigHandler::INT_TYPE:
+                    configHandler.registerInteger(name.groupName, name.itemName, error);
+                    break;
+                case ConfigHandler::FLOAT_TYPE:
+                    configHandler.registerFloat(name.groupName, name.itemName, error);
+                    break;
+                case ConfigHandler::BOOL_TYPE:
+                    configHandler.registerBoolean(name.groupName, name.itemName, error);
+                    break;
+                case ConfigHandler::STRING_ARRAY_TYPE:
+                    configHandler.registerStringArray(name.groupName, name.itemName, error);
+                    break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief benchmark getString
+ */
+void
+ConfigHandler_Benchmark::benchmarkGetString(ConfigHandler &configHandler)
+{
+    const std::vector<ItemName> &names = m_names[ConfigHandler::STRING_TYPE];
+    const ConfigKey<std::string> key = {0};
+    bool success = false;
+    uint64_t pos = 0;
+
+    double nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        const ItemName &name = names[pos++ % names.size()];
+        return configHandler.getString(name.groupName, name.itemName, success).size();
+    });
+    printResult("getString", "hit", NUMBER_OF_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        const ItemName &name = m_missingNames[pos++ % m_missingNames.size()];
+        return configHandler.getString(name.groupName, name.itemName, success).size();
+    });
+    printResult("getString", "miss", NUMBER_OF_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        return configHandler.getString(key, success).size();
+    });
+    printResult("getString", "key", NUMBER_OF_ITERATIONS, nsPerOp);
+}
+
+/**
+ * @brief benchmark getInteger
+ */
+void
+ConfigHandler_Benchmark::benchmarkGetInteger(ConfigHandler &configHandler)
+{
+    const std::vector<ItemName> &names = m_names[ConfigHandler::INT_TYPE];
+    const ConfigKey<long> key = {0};
+    bool success = false;
+    uint64_t pos = 0;
+
+    double nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        const ItemName &name = names[pos++ % names.size()];
+        return configHandler.getInteger(name.groupName, name.itemName, success);
+    });
+    printResult("getInteger", "hit", NUMBER_OF_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        const ItemName &name = m_missingNames[pos++ % m_missingNames.size()];
+        return configHandler.getInteger(name.groupName, name.itemName, success);
+    });
+    printResult("getInteger", "miss", NUMBER_OF_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        return configHandler.getInteger(key, success);
+    });
+    printResult("getInteger", "key", NUMBER_OF_ITERATIONS, nsPerOp);
+}
+
+/**
+ * @brief benchmark getFloat
+ */
+void
+ConfigHandler_Benchmark::benchmarkGetFloat(ConfigHandler &configHandler)
+{
+    const std::vector<ItemName> &names = m_names[ConfigHandler::FLOAT_TYPE];
+    const ConfigKey<double> key = {0};
+    bool success = false;
+    uint64_t pos = 0;
+
+    double nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        const ItemName &name = names[pos++ % names.size()];
+        return configHandler.getFloat(name.groupName, name.itemName, success);
+    });
+    printResult("getFloat", "hit", NUMBER_OF_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        const ItemName &name = m_missingNames[pos++ % m_missingNames.size()];
+        return configHandler.getFloat(name.groupName, name.itemName, success);
+    });
+    printResult("getFloat", "miss", NUMBER_OF_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        return configHandler.getFloat(key, success);
+    });
+    printResult("getFloat", "key", NUMBER_OF_ITERATIONS, nsPerOp);
+}
+
+/**
+ * @brief benchmark getBoolean
+ */
+void
+ConfigHandler_Benchmark::benchmarkGetBoolean(ConfigHandler &configHandler)
+{
+    const std::vector<ItemName> &names = m_names[ConfigHandler::BOOL_TYPE];
+    const ConfigKey<bool> key = {0};
+    bool success = false;
+    uint64_t pos = 0;
+
+    double nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        const ItemName &name = names[pos++ % names.size()];
+        return configHandler.getBoolean(name.groupName, name.itemName, success);
+    });
+    printResult("getBoolean", "hit", NUMBER_OF_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        const ItemName &name = m_missingNames[pos++ % m_missingNames.size()];
+        return configHandler.getBoolean(name.groupName, name.itemName, success);
+    });
+    printResult("getBoolean", "miss", NUMBER_OF_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ITERATIONS, [&]() {
+        return configHandler.getBoolean(key, success);
+    });
+    printResult("getBoolean", "key", NUMBER_OF_ITERATIONS, nsPerOp);
+}
+
+/**
+ * @brief benchmark getStringArray
+ */
+void
+ConfigHandler_Benchmark::benchmarkGetStringArray(ConfigHandler &configHandler)
+{
+    const std::vector<ItemName> &names = m_names[ConfigHandler::STRING_ARRAY_TYPE];
+    const ConfigKey<std::vector<std::string>> key = {0};
+    bool success = false;
+    uint64_t pos = 0;
+
+    double nsPerOp = measure(NUMBER_OF_ARRAY_ITERATIONS, [&]() {
+        const ItemName &name = names[pos++ % names.size()];
+        return configHandler.getStringArray(name.groupName, name.itemName, success).size();
+    });
+    printResult("getStringArray", "hit", NUMBER_OF_ARRAY_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ARRAY_ITERATIONS, [&]() {
+        const ItemName &name = m_missingNames[pos++ % m_missingNames.size()];
+        return configHandler.getStringArray(name.groupName, name.itemName, success).size();
+    });
+    printResult("getStringArray", "miss", NUMBER_OF_ARRAY_ITERATIONS, nsPerOp);
+
+    nsPerOp = measure(NUMBER_OF_ARRAY_ITERATIONS, [&]() {
+        return configHandler.getStringArray(key, success).size();
+    });
+    printResult("getStringArray", "key", NUMBER_OF_ARRAY_ITERATIONS, nsPerOp);
+}
+
+/**
+ * @brief run a function multiple times in a row and take the median of all repetitions, to
+ *        reduce the influence of other processes on the result
+ *
+ * @param iterations number of calls per repetition
+ * @param function function to measure
+ *
+ * @return median time per call in nanoseconds
+ */
+template<typename FUNC>
+double
+ConfigHandler_Benchmark::measure(const uint64_t iterations, FUNC function)
+{
+    std::vector<double> results;
+    uint64_t sink = 0;
+
+    // warm up caches and branch-predictors
+    for(uint64_t i = 0; i < iterations / 8; i++) {
+        sink += static_cast<uint64_t>(function());
+    }
+
+    for(uint32_t r = 0; r < NUMBER_OF_REPETITIONS; r++)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(uint64_t i = 0; i < iterations; i++) {
+            sink += static_cast<uint64_t>(function());
+        }
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        const double duration = std::chrono::duration<double, std::nano>(end - start).count();
+        results.push_back(duration / static_cast<double>(iterations));
+    }
+
+    m_sink = m_sink + sink;
+    std::sort(results.begin(), results.end());
+    return results[results.size() / 2];
+}
+
+/**
+ * @brief print result of a measurement as one line of key=value pairs
+ */
+void
+ConfigHandler_Benchmark::printResult(const std::string &benchmark,
+                                     const std::string &testCase,
+                                     const uint64_t iterations,
+                                     const double nsPerOp)
+{
+    printf("benchmark=%s case=%s keys=%u groups=%u iterations=%lu ns_per_op=%.2f\n",
+           benchmark.c_str(),
+           testCase.c_str(),
+           m_numberOfKeys,
+           m_numberOfGroups,
+           static_cast<unsigned long>(iterations),
+           nsPerOp);
+    fflush(stdout);
+}
+
+/**
+ * @brief create a config-file with items, which are distributed over all groups and types, and
+ *        collect the names of the items for the registration and the getter
+ *
+ * @param numberOfKeys number of items
+ * @param numberOfGroups number of groups
+ *
+ * @return content of the config-file
+ */
+const std::string
+ConfigHandler_Benchmark::createConfigString(const uint32_t numberOfKeys,
+                                            const uint32_t numberOfGroups)
+{
+    m_names.clear();
+    m_names.resize(ConfigHandler::STRING_ARRAY_TYPE + 1);
+    m_missingNames.clear();
+
+    std::vector<std::string> groupContents(numberOfGroups);
+    for(uint32_t i = 0; i < numberOfKeys; i++)
+    {
+        const uint32_t type = ConfigHandler::STRING_TYPE + (i % 5);
+        const std::string index = std::to_string(i);
+
+        ItemName name;
+        name.groupName = "group_" + std::to_string(i % numberOfGroups);
+        name.itemName = "item_" + index;
+        m_names[type].push_back(name);
+
+        ItemName missingName;
+        missingName.groupName = name.groupName;
+        missingName.itemName = "missing_item_" + index;
+        m_missingNames.push_back(missingName);
+
+        std::string &content = groupContents[i % numberOfGroups];
+        switch(type)
+        {
+            case ConfigHandler::STRING_TYPE:
+                content += name.itemName + " = value_" + index + "\n";
+                break;
+            case ConfigHandler::INT_TYPE:
+                content += name.itemName + " = " + index + "\n";
+                break;
+            case ConfigHandler::FLOAT_TYPE:
+                content += name.itemName + " = " + index + ".5\n";
+                break;
+            case ConfigHandler::BOOL_TYPE:
+                content += name.itemName + " = " + (i % 2 == 0 ? "true" : "false") + "\n";
+                break;
+            case ConfigHandler::STRING_ARRAY_TYPE:
+                content += name.itemName + " = a,bc,def\n";
+                break;
+        }
+    }
+
+    std::string result = "";
+    for(uint32_t i = 0; i < numberOfGroups; i++) {
+        result += "[group_" + std::to_string(i) + "]\n" + groupContents[i] + "\n";
+    }
+
+    return result;
+}
+
+} // namespace Kitsunemimi
@@ -0,0 +1,88 @@
+/**
+ *  @file       config_handler_benchmark.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_HANDLER_BENCHMARK_H
+#define CONFIG_HANDLER_BENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace Kitsunemimi
+{
+class ConfigHandler;
+
+/**
+ * @brief measures the time per call of the getter for all value-types and the time of the
+ *        registration per item. Each measurement is repeated multiple times and the median is
+ *        printed as one line of key=value pairs:
+ *
+ *        benchmark=getInteger case=hit keys=1000 groups=10 iterations=1048576 ns_per_op=8.12
+ *
+ *        The loading of directories with many config-files is measured for different numbers of
+ *        threads together with the speedup against a single thread. If the library is built with
+ *        access-statistics, their costs per getter-call are compared against a fixed bound and
+ *        the benchmark fails, if they exceed it.
+ */
+class ConfigHandler_Benchmark
+{
+public:
+    ConfigHandler_Benchmark();
+
+    bool isWithinBounds() const { return m_withinBounds; }
+
+private:
+    struct ItemName
+    {
+        std::string groupName = "";
+        std::string itemName = "";
+    };
+
+    void runSetup(const uint32_t numberOfKeys,
+                  const uint32_t numberOfGroups);
+
+    void benchmarkFragments(const uint32_t numberOfFragments);
+    void benchmarkAccessStats();
+    void benchmarkRegistration();
+    void registerSingle(ConfigHandler &configHandler);
+
+    void benchmarkGetString(ConfigHandler &configHandler);
+    void benchmarkGetInteger(ConfigHandler &configHandler);
+    void benchmarkGetFloat(ConfigHandler &configHandler);
+    void benchmarkGetBoolean(ConfigHandler &configHandler);
+    void benchmarkGetStringArray(ConfigHandler &configHandler);
+
+    template<typename FUNC>
+    double measure(const uint64_t iterations, FUNC function);
+    void printResult(const std::string &benchmark,
+                     const std::string &testCase,
+                     const uint64_t iterations,
+                     const double nsPerOp);
+
+    const std::string createConfigString(const uint32_t numberOfKeys,
+                                         const uint32_t numberOfGroups);
+
+    std::string m_testFilePath = "/tmp/ConfigHandler_Benchmark.ini";
+    std::string m_testDirectoryPath = "/tmp/ConfigHandler_Benchmark.d";
+
+    // names of the registered items per type and names, which are not registered
+    std::vector<std::vector<ItemName>> m_names;
+    std::vector<ItemName> m_missingNames;
+    uint32_t m_numberOfKeys = 0;
+    uint32_t m_numberOfGroups = 0;
+
+    // results are summed up here, so the compiler can not remove the getter-calls
+    volatile uint64_t m_sink = 0;
+
+    // false, if at least one measurement has exceeded its bound
+    bool m_withinBounds = true;
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_HANDLER_BENCHMARK_H
@@ -0,0 +1,22 @@
+/**
+ *  @file       main.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include <iostream>
+#include <config_handler_benchmark.h>
+
+int main()
+{
+    Kitsunemimi::ConfigHandler_Benchmark configHandler_Benchmark;
+
+    // fail the benchmark-run, if a measurement exceeds its bound
+    if(configHandler_Benchmark.isWithinBounds() == false) {
+        return 1;
+    }
+
+    return 0;
+}
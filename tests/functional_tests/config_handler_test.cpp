@@ -34,7 +34,7 @@ ConfigHandler_Test::runTest()
     TEST_EQUAL(Kitsunemimi::initConfig(m_testFilePath, error), true);
 
     REGISTER_STRING_CONFIG("DEFAULT", "string_val", error, "");
-    REGISTER_INT_CONFIG("DEFAULT", "int_val", error, 42);
+    const ConfigKey<long> intKey = REGISTER_INT_CONFIG("DEFAULT", "int_val", error, 42);
     REGISTER_INT_CONFIG("DEFAULT", "another_int_val", error, 42);
 
     bool success = false;
@@ -46,6 +46,15 @@ ConfigHandler_Test::runTest()
     TEST_EQUAL(success, true);
     TEST_EQUAL(GET_STRING_CONFIG("DEFAULT", "fail", success), "");
     TEST_EQUAL(success, false);
+    TEST_EQUAL(GET_INT_CONFIG(intKey, success), 2);
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(GET_STRING_VIEW_CONFIG("DEFAULT", "string_val", success), "");
+    TEST_EQUAL(success, false);
+
+    // views are only available after the seal
+    Kitsunemimi::sealConfig();
+    TEST_EQUAL(GET_STRING_VIEW_CONFIG("DEFAULT", "string_val", success), "asdf.asdf");
+    TEST_EQUAL(success, true);
 
     Kitsunemimi::deleteFileOrDir(m_testFilePath, error);
 
@@ -3,7 +3,7 @@ include(../../defaults.pri)
 QT -= qt core gui
 
 CONFIG   -= app_bundle
-CONFIG += c++17 console
+CONFIG += c++17 console thread
 
 LIBS += -L../../src -lKitsunemimiConfig
 
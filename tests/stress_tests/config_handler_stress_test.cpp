@@ -0,0 +1,236 @@
+/**
+ *  @file       config_handler_stress_test.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include "config_handler_stress_test.h"
+
+#include <libKitsunemimiConfig/config_handler.h>
+#include <libKitsunemimiCommon/files/text_file.h>
+#include <libKitsunemimiCommon/methods/file_methods.h>
+
+#include <chrono>
+#include <thread>
+
+namespace Kitsunemimi
+{
+
+ConfigHandler_StressTest::ConfigHandler_StressTest()
+    : Kitsunemimi::CompareTestHelper("ConfigHandler_StressTest")
+{
+    initTestCase();
+
+    concurrentRead_test();
+    concurrentReadWithReload_test();
+
+    cleanupTestCase();
+}
+
+/**
+ * initTestCase
+ */
+void
+ConfigHandler_StressTest::initTestCase()
+{
+    ErrorContainer error;
+    Kitsunemimi::writeFile(m_testFilePath, getTestString(false), error, true);
+
+    Kitsunemimi::initConfig(m_testFilePath, error);
+    REGISTER_STRING_CONFIG("DEFAULT", "string_val", error, "");
+    REGISTER_INT_CONFIG("DEFAULT", "int_val", error, 42);
+    REGISTER_FLOAT_CONFIG("DEFAULT", "float_val", error, 42.0);
+    REGISTER_BOOL_CONFIG("DEFAULT", "bool_value", error, false);
+    REGISTER_STRING_ARRAY_CONFIG("DEFAULT", "string_list", error);
+    Kitsunemimi::sealConfig();
+
+    TEST_EQUAL(Kitsunemimi::isConfigValid(), true);
+}
+
+/**
+ * @brief read all values with many threads at the same time
+ */
+void
+ConfigHandler_StressTest::concurrentRead_test()
+{
+    runReaders(64, false);
+}
+
+/**
+ * @brief read all values with many threads, while the config is reloaded again and again
+ */
+void
+ConfigHandler_StressTest::concurrentReadWithReload_test()
+{
+    runReaders(64, true);
+}
+
+/**
+ * cleanupTestCase
+ */
+void
+ConfigHandler_StressTest::cleanupTestCase()
+{
+    ErrorContainer error;
+    Kitsunemimi::resetConfig();
+    Kitsunemimi::deleteFileOrDir(m_testFilePath, error);
+}
+
+/**
+ * @brief run reader-threads for a fixed time and print the aggregated throughput
+ *
+ * @param numberOfThreads number of reader-threads
+ * @param withReload true to reload the config in parallel
+ */
+void
+ConfigHandler_StressTest::runReaders(const uint32_t numberOfThreads,
+                                     const bool withReload)
+{
+    m_numberOfReads = 0;
+    m_numberOfErrors = 0;
+    m_numberOfReloads = 0;
+    m_running = true;
+
+    std::vector<std::thread> threads;
+    for(uint32_t i = 0; i < numberOfThreads; i++) {
+        threads.emplace_back(&ConfigHandler_StressTest::readLoop, this);
+    }
+    if(withReload) {
+        threads.emplace_back(&ConfigHandler_StressTest::reloadLoop, this);
+    }
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    m_running = false;
+    for(std::thread &thread : threads) {
+        thread.join();
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    const double duration = std::chrono::duration<double>(end - start).count();
+    std::cout << "threads: " << numberOfThreads
+              << "   reloads: " << m_numberOfReloads.load()
+              << "   reads: " << m_numberOfReads.load()
+              << "   reads/s: " << static_cast<uint64_t>(m_numberOfReads.load() / duration)
+              << std::endl;
+
+    TEST_EQUAL(m_numberOfErrors.load(), 0);
+    if(withReload) {
+        TEST_NOT_EQUAL(m_numberOfReloads.load(), 0);
+    }
+}
+
+/**
+ * @brief read all five value-types in a loop and check, that every value belongs to one of the
+ *        two config-files, which are switched by the reload
+ */
+void
+ConfigHandler_StressTest::readLoop()
+{
+    bool success = false;
+    uint64_t numberOfReads = 0;
+    uint64_t numberOfErrors = 0;
+
+    while(m_running.load(std::memory_order_relaxed))
+    {
+        const std::string stringVal = GET_STRING_CONFIG("DEFAULT", "string_val", success);
+        if(success == false
+                || (stringVal != "asdf.asdf" && stringVal != "poi.poi"))
+        {
+            numberOfErrors++;
+        }
+
+        const long intVal = GET_INT_CONFIG("DEFAULT", "int_val", success);
+        if(success == false
+                || (intVal != 2 && intVal != 3))
+        {
+            numberOfErrors++;
+        }
+
+        const double floatVal = GET_FLOAT_CONFIG("DEFAULT", "float_val", success);
+        if(success == false
+                || (floatVal != 123.0 && floatVal != 321.0))
+        {
+            numberOfErrors++;
+        }
+
+        GET_BOOL_CONFIG("DEFAULT", "bool_value", success);
+        if(success == false) {
+            numberOfErrors++;
+        }
+
+        const std::vector<std::string> arrayVal = GET_STRING_ARRAY_CONFIG("DEFAULT",
+                                                                          "string_list",
+                                                                          success);
+        if(success == false
+                || (arrayVal.size() != 3 && arrayVal.size() != 2))
+        {
+            numberOfErrors++;
+        }
+
+        numberOfReads += 5;
+    }
+
+    m_numberOfReads += numberOfReads;
+    m_numberOfErrors += numberOfErrors;
+}
+
+/**
+ * @brief switch the config-file and reload the config in a loop
+ */
+void
+ConfigHandler_StressTest::reloadLoop()
+{
+    ErrorContainer error;
+    bool alternative = false;
+
+    while(m_running.load(std::memory_order_relaxed))
+    {
+        alternative = alternative == false;
+        Kitsunemimi::writeFile(m_testFilePath, getTestString(alternative), error, true);
+        if(Kitsunemimi::reloadConfig(error)) {
+            m_numberOfReloads++;
+        }
+        else {
+            m_numberOfErrors++;
+        }
+    }
+}
+
+/**
+ * @brief get content of the test-config
+ *
+ * @param alternative true to get the alternative values
+ *
+ * @return content for the config-file
+ */
+const std::string
+ConfigHandler_StressTest::getTestString(const bool alternative)
+{
+    if(alternative)
+    {
+        const std::string testString(
+                    "[DEFAULT]\n"
+                    "string_val = poi.poi\n"
+                    "int_val = 3\n"
+                    "float_val = 321.0\n"
+                    "string_list = x,y\n"
+                    "bool_value = false\n"
+                    "\n");
+        return testString;
+    }
+
+    const std::string testString(
+                "[DEFAULT]\n"
+                "string_val = asdf.asdf\n"
+                "int_val = 2\n"
+                "float_val = 123.0\n"
+                "string_list = a,b,c\n"
+                "bool_value = true\n"
+                "\n");
+    return testString;
+}
+
+} // namespace Kitsunemimi
@@ -0,0 +1,49 @@
+/**
+ *  @file       config_handler_stress_test.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_HANDLER_STRESS_TEST_H
+#define CONFIG_HANDLER_STRESS_TEST_H
+
+#include <atomic>
+#include <libKitsunemimiCommon/test_helper/compare_test_helper.h>
+
+namespace Kitsunemimi
+{
+
+class ConfigHandler_StressTest
+        : public Kitsunemimi::CompareTestHelper
+{
+public:
+    ConfigHandler_StressTest();
+
+private:
+    void initTestCase();
+
+    void concurrentRead_test();
+    void concurrentReadWithReload_test();
+
+    void cleanupTestCase();
+
+    void runReaders(const uint32_t numberOfThreads,
+                    const bool withReload);
+    void readLoop();
+    void reloadLoop();
+
+    const std::string getTestString(const bool alternative);
+
+    std::string m_testFilePath = "/tmp/ConfigHandler_StressTest.ini";
+
+    std::atomic<bool> m_running {false};
+    std::atomic<uint64_t> m_numberOfReads {0};
+    std::atomic<uint64_t> m_numberOfErrors {0};
+    std::atomic<uint64_t> m_numberOfReloads {0};
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_HANDLER_STRESS_TEST_H
@@ -0,0 +1,16 @@
+/**
+ *  @file       main.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include <iostream>
+#include <config_handler_stress_test.h>
+
+int main()
+{
+    Kitsunemimi::ConfigHandler_StressTest configHandler_StressTest;
+    return 0;
+}
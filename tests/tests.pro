@@ -5,6 +5,8 @@ CONFIG += c++17
 
 SUBDIRS = \
     unit_tests \
-    functional_tests
+    functional_tests \
+    stress_tests \
+    benchmark_tests
 
 tests.depends = src
@@ -0,0 +1,207 @@
+/**
+ *  @file       config_binding_test.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include "config_binding_test.h"
+
+#include <libKitsunemimiConfig/config_binding.h>
+#include <libKitsunemimiCommon/files/text_file.h>
+#include <libKitsunemimiCommon/methods/file_methods.h>
+
+namespace Kitsunemimi
+{
+
+struct ServerSettings
+{
+    std::string host = "localhost";
+    long port = 8080;
+    double timeout = 1.5;
+    bool tls = false;
+    std::vector<std::string> aliases;
+    long workers = 4;
+    std::chrono::nanoseconds idleTimeout = std::chrono::seconds(30);
+    uint64_t bufferSize = 4096;
+    uint64_t maxBodySize = 1024;
+};
+
+ConfigBinding_Test::ConfigBinding_Test()
+    : Kitsunemimi::CompareTestHelper("ConfigBinding_Test")
+{
+    initTestCase();
+
+    bindGroup_test();
+    load_test();
+    reload_test();
+
+    cleanupTestCase();
+}
+
+/**
+ * initTestCase
+ */
+void
+ConfigBinding_Test::initTestCase()
+{
+    ErrorContainer error;
+    Kitsunemimi::writeFile(m_testFilePath, getTestString(), error, true);
+}
+
+/**
+ * @brief bindGroup_test
+ */
+void
+ConfigBinding_Test::bindGroup_test()
+{
+    ErrorContainer error;
+
+    ConfigHandler configHandler;
+    configHandler.initConfig(m_testFilePath, error);
+    ConfigBinding<ServerSettings> binding = bindGroup<ServerSettings>(
+                configHandler,
+                "server",
+                {{"host", &ServerSettings::host},
+                 {"port", &ServerSettings::port, true}},
+                error);
+    TEST_EQUAL(binding.isValid(), true);
+    TEST_EQUAL(configHandler.isConfigValid(), true);
+
+    // type doesn't match the value in the file
+    ConfigHandler brokenHandler;
+    brokenHandler.initConfig(m_testFilePath, error);
+    ConfigBinding<ServerSettings> brokenBinding = bindGroup<ServerSettings>(
+                brokenHandler,
+                "server",
+                {{"host", &ServerSettings::workers}},
+                error);
+    TEST_EQUAL(brokenBinding.isValid(), false);
+    TEST_EQUAL(brokenHandler.isConfigValid(), false);
+
+    // missing required item
+    ConfigHandler missingHandler;
+    missingHandler.initConfig(m_testFilePath, error);
+    ConfigBinding<ServerSettings> missingBinding = bindGroup<ServerSettings>(
+                missingHandler,
+                "server",
+                {{"workers", &ServerSettings::workers, true}},
+                error);
+    TEST_EQUAL(missingBinding.isValid(), false);
+
+    // binding without handler
+    ConfigBinding<ServerSettings> emptyBinding;
+    ServerSettings settings;
+    TEST_EQUAL(emptyBinding.isValid(), false);
+    TEST_EQUAL(emptyBinding.load(settings), false);
+}
+
+/**
+ * @brief load_test
+ */
+void
+ConfigBinding_Test::load_test()
+{
+    ErrorContainer error;
+
+    ConfigHandler configHandler;
+    configHandler.initConfig(m_testFilePath, error);
+    ConfigBinding<ServerSettings> binding = bindGroup<ServerSettings>(
+                configHandler,
+                "server",
+                {{"host", &ServerSettings::host},
+                 {"port", &ServerSettings::port},
+                 {"timeout", &ServerSettings::timeout},
+                 {"tls", &ServerSettings::tls},
+                 {"aliases", &ServerSettings::aliases},
+                 {"workers", &ServerSettings::workers},
+                 {"idle_timeout", &ServerSettings::idleTimeout},
+                 {"buffer_size", &ServerSettings::bufferSize},
+                 {"max_body_size", &ServerSettings::maxBodySize}},
+                error);
+    TEST_EQUAL(binding.isValid(), true);
+    configHandler.sealConfig();
+
+    ServerSettings settings;
+    TEST_EQUAL(binding.load(settings), true);
+    TEST_EQUAL(settings.host, "example.com");
+    TEST_EQUAL(settings.port, 443);
+    TEST_EQUAL(settings.timeout, 2.5);
+    TEST_EQUAL(settings.tls, true);
+    TEST_EQUAL(settings.aliases.size(), 2);
+    if(settings.aliases.size() == 2) {
+        TEST_EQUAL(settings.aliases.at(1), "b.example.com");
+    }
+
+    // values with a unit are converted at the registration
+    TEST_EQUAL(settings.idleTimeout.count(), 90000000000l);
+    TEST_EQUAL(settings.bufferSize, 65536);
+
+    // default comes from the default-constructed struct
+    TEST_EQUAL(settings.workers, 4);
+    TEST_EQUAL(settings.maxBodySize, 1024);
+}
+
+/**
+ * @brief reload_test
+ */
+void
+ConfigBinding_Test::reload_test()
+{
+    ErrorContainer error;
+
+    ConfigHandler configHandler;
+    configHandler.initConfig(m_testFilePath, error);
+    ConfigBinding<ServerSettings> binding = bindGroup<ServerSettings>(
+                configHandler,
+                "server",
+                {{"host", &ServerSettings::host},
+                 {"port", &ServerSettings::port}},
+                error);
+    configHandler.sealConfig();
+
+    std::string newContent = getTestString();
+    newContent.replace(newContent.find("443"), 3, "8443");
+    Kitsunemimi::writeFile(m_testFilePath, newContent, error, true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+
+    ServerSettings settings;
+    TEST_EQUAL(binding.load(settings), true);
+    TEST_EQUAL(settings.port, 8443);
+    TEST_EQUAL(settings.host, "example.com");
+
+    Kitsunemimi::writeFile(m_testFilePath, getTestString(), error, true);
+}
+
+/**
+ * cleanupTestCase
+ */
+void
+ConfigBinding_Test::cleanupTestCase()
+{
+    ErrorContainer error;
+    Kitsunemimi::deleteFileOrDir(m_testFilePath, error);
+}
+
+/**
+ * @brief ConfigBinding_Test::getTestString
+ * @return
+ */
+const std::string
+ConfigBinding_Test::getTestString()
+{
+    const std::string testString(
+                "[server]\n"
+                "host = example.com\n"
+                "port = 443\n"
+                "timeout = 2.5\n"
+                "tls = true\n"
+                "aliases = a.example.com,b.example.com\n"
+                "idle_timeout = 1m30s\n"
+                "buffer_size = 64KiB\n"
+                "\n");
+    return testString;
+}
+
+} // namespace Kitsunemimi
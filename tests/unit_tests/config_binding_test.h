@@ -0,0 +1,39 @@
+/**
+ *  @file       config_binding_test.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_BINDING_TEST_H
+#define CONFIG_BINDING_TEST_H
+
+#include <libKitsunemimiCommon/test_helper/compare_test_helper.h>
+
+namespace Kitsunemimi
+{
+
+class ConfigBinding_Test
+        : public Kitsunemimi::CompareTestHelper
+{
+public:
+    ConfigBinding_Test();
+
+private:
+    void initTestCase();
+
+    void bindGroup_test();
+    void load_test();
+    void reload_test();
+
+    void cleanupTestCase();
+
+    const std::string getTestString();
+
+    std::string m_testFilePath = "/tmp/ConfigBinding_Test.ini";
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_BINDING_TEST_H
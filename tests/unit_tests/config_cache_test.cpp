@@ -0,0 +1,192 @@
+/**
+ *  @file       config_cache_test.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include "config_cache_test.h"
+
+#include <config_cache.h>
+#include <libKitsunemimiCommon/files/text_file.h>
+#include <libKitsunemimiCommon/methods/file_methods.h>
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief create cache-entries and values for the tests
+ */
+static void
+createTestCache(std::vector<std::vector<ConfigCache::CacheEntry>> &entries,
+                ConfigSnapshot &values)
+{
+    entries.resize(ConfigHandler::STRING_ARRAY_TYPE + 1);
+
+    ConfigCache::CacheEntry stringEntry;
+    stringEntry.groupName = "DEFAULT";
+    stringEntry.itemName = "string_val";
+    stringEntry.type = ConfigHandler::STRING_TYPE;
+    stringEntry.inFile = true;
+    entries[ConfigHandler::STRING_TYPE].push_back(stringEntry);
+    values.appendString("asdf");
+
+    ConfigCache::CacheEntry intEntry;
+    intEntry.groupName = "DEFAULT";
+    intEntry.itemName = "int_val";
+    intEntry.type = ConfigHandler::INT_TYPE;
+    intEntry.required = true;
+    intEntry.inFile = true;
+    entries[ConfigHandler::INT_TYPE].push_back(intEntry);
+    values.appendInteger(2);
+
+    ConfigCache::CacheEntry defaultEntry;
+    defaultEntry.groupName = "DEFAULT";
+    defaultEntry.itemName = "int_val2";
+    defaultEntry.type = ConfigHandler::INT_TYPE;
+    entries[ConfigHandler::INT_TYPE].push_back(defaultEntry);
+    values.appendInteger(42);
+
+    // values with a unit are stored together with the integers
+    ConfigCache::CacheEntry durationEntry;
+    durationEntry.groupName = "DEFAULT";
+    durationEntry.itemName = "timeout";
+    durationEntry.type = ConfigHandler::DURATION_TYPE;
+    durationEntry.inFile = true;
+    entries[ConfigHandler::INT_TYPE].push_back(durationEntry);
+    values.appendInteger(5000000000l);
+}
+
+ConfigCache_Test::ConfigCache_Test()
+    : Kitsunemimi::CompareTestHelper("ConfigCache_Test")
+{
+    writeCache_test();
+    parseCache_test();
+    matches_test();
+    appendValue_test();
+    hashData_test();
+
+    ErrorContainer error;
+    Kitsunemimi::deleteFileOrDir(m_cacheFilePath, error);
+}
+
+/**
+ * @brief writeCache_test
+ */
+void
+ConfigCache_Test::writeCache_test()
+{
+    ErrorContainer error;
+    std::vector<std::vector<ConfigCache::CacheEntry>> entries;
+    ConfigSnapshot values;
+    createTestCache(entries, values);
+
+    TEST_EQUAL(ConfigCache::writeCache(m_cacheFilePath, 1234, entries, values, error), true);
+    TEST_EQUAL(ConfigCache::writeCache("/tmp/asönganergupuneruigndf/cache",
+                                       1234,
+                                       entries,
+                                       values,
+                                       error),
+               false);
+}
+
+/**
+ * @brief parseCache_test
+ */
+void
+ConfigCache_Test::parseCache_test()
+{
+    ErrorContainer error;
+    std::string content = "";
+    readFile(content, m_cacheFilePath, error);
+
+    ConfigCache cache;
+    TEST_EQUAL(cache.parseCache(content, 1234), true);
+
+    std::vector<std::vector<ConfigCache::CacheEntry>> entries;
+    ConfigSnapshot values;
+    createTestCache(entries, values);
+    TEST_EQUAL(cache.schemaHash, ConfigCache::hashSchema(entries));
+
+    // cache of another config-file
+    ConfigCache otherCache;
+    TEST_EQUAL(otherCache.parseCache(content, 4321), false);
+
+    // broken cache
+    ConfigCache truncatedCache;
+    TEST_EQUAL(truncatedCache.parseCache(content.substr(0, content.size() - 1), 1234), false);
+    ConfigCache emptyCache;
+    TEST_EQUAL(emptyCache.parseCache("", 1234), false);
+}
+
+/**
+ * @brief matches_test
+ */
+void
+ConfigCache_Test::matches_test()
+{
+    ErrorContainer error;
+    std::string content = "";
+    readFile(content, m_cacheFilePath, error);
+    ConfigCache cache;
+    cache.parseCache(content, 1234);
+
+    TEST_EQUAL(cache.matches("DEFAULT", "int_val", ConfigHandler::INT_TYPE, true, 0), true);
+    TEST_EQUAL(cache.matches("DEFAULT", "int_val2", ConfigHandler::INT_TYPE, false, 1), true);
+    TEST_EQUAL(cache.matches("DEFAULT", "string_val", ConfigHandler::STRING_TYPE, false, 0), true);
+    TEST_EQUAL(cache.matches("DEFAULT", "timeout", ConfigHandler::DURATION_TYPE, false, 2), true);
+
+    // other position, type, name or flag
+    TEST_EQUAL(cache.matches("DEFAULT", "int_val", ConfigHandler::INT_TYPE, true, 1), false);
+    TEST_EQUAL(cache.matches("DEFAULT", "int_val", ConfigHandler::FLOAT_TYPE, true, 0), false);
+    TEST_EQUAL(cache.matches("DEFAULT", "int_val", ConfigHandler::INT_TYPE, false, 0), false);
+    TEST_EQUAL(cache.matches("other", "int_val", ConfigHandler::INT_TYPE, true, 0), false);
+    TEST_EQUAL(cache.matches("DEFAULT", "int_val", ConfigHandler::INT_TYPE, true, 2), false);
+    TEST_EQUAL(cache.matches("DEFAULT", "timeout", ConfigHandler::INT_TYPE, false, 2), false);
+    TEST_EQUAL(cache.matches("DEFAULT", "timeout", ConfigHandler::BYTE_SIZE_TYPE, false, 2), false);
+}
+
+/**
+ * @brief appendValue_test
+ */
+void
+ConfigCache_Test::appendValue_test()
+{
+    ErrorContainer error;
+    std::string content = "";
+    readFile(content, m_cacheFilePath, error);
+    ConfigCache cache;
+    cache.parseCache(content, 1234);
+
+    ConfigSnapshot defaults;
+    defaults.appendInteger(0);
+    defaults.appendInteger(43);
+
+    // values, which were not in the config-file, come from the current defaults
+    ConfigSnapshot snapshot;
+    cache.appendValue(&snapshot, &defaults, ConfigHandler::INT_TYPE, 0);
+    cache.appendValue(&snapshot, &defaults, ConfigHandler::INT_TYPE, 1);
+    TEST_EQUAL(snapshot.getInteger(0), 2);
+    TEST_EQUAL(snapshot.getInteger(1), 43);
+    TEST_EQUAL(cache.isInFile(ConfigHandler::INT_TYPE, 0), true);
+    TEST_EQUAL(cache.isInFile(ConfigHandler::INT_TYPE, 1), false);
+    TEST_EQUAL(cache.isInFile(ConfigHandler::DURATION_TYPE, 2), true);
+}
+
+/**
+ * @brief hashData_test
+ */
+void
+ConfigCache_Test::hashData_test()
+{
+    const std::string data = "[DEFAULT]\nint_val = 2\n";
+    const std::string otherData = "[DEFAULT]\nint_val = 3\n";
+
+    TEST_EQUAL(ConfigCache::hashData(data.data(), data.size()),
+               ConfigCache::hashData(data.data(), data.size()));
+    TEST_NOT_EQUAL(ConfigCache::hashData(data.data(), data.size()),
+                   ConfigCache::hashData(otherData.data(), otherData.size()));
+}
+
+} // namespace Kitsunemimi
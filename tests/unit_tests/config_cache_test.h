@@ -0,0 +1,35 @@
+/**
+ *  @file       config_cache_test.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_CACHE_TEST_H
+#define CONFIG_CACHE_TEST_H
+
+#include <libKitsunemimiCommon/test_helper/compare_test_helper.h>
+
+namespace Kitsunemimi
+{
+
+class ConfigCache_Test
+        : public Kitsunemimi::CompareTestHelper
+{
+public:
+    ConfigCache_Test();
+
+private:
+    void writeCache_test();
+    void parseCache_test();
+    void matches_test();
+    void appendValue_test();
+    void hashData_test();
+
+    std::string m_cacheFilePath = "/tmp/ConfigCache_Test.cache";
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_CACHE_TEST_H
@@ -9,9 +9,16 @@
 #include "config_handler_test.h"
 
 #include <libKitsunemimiConfig/config_handler.h>
+#include <config_access_stats.h>
+#include <config_snapshot.h>
+#include <counting_allocator.h>
 #include <libKitsunemimiCommon/files/text_file.h>
 #include <libKitsunemimiCommon/methods/file_methods.h>
 
+#include <thread>
+#include <sys/stat.h>
+#include <fcntl.h>
+
 namespace Kitsunemimi
 {
 
@@ -21,12 +28,17 @@ ConfigHandler_Test::ConfigHandler_Test()
     initTestCase();
 
     readConfig_test();
+    readConfigFile_test();
 
     // private methods
     registerType_test();
     isRegistered_test();
     getRegisteredType_test();
     checkType_test();
+    hashGroups_test();
+    extractIncludes_test();
+    parseDuration_test();
+    parseByteSize_test();
 
     // public methods
     registerString_test();
@@ -34,11 +46,30 @@ ConfigHandler_Test::ConfigHandler_Test()
     registerFloat_test();
     registerBoolean_test();
     registerStringArray_test();
+    registerDuration_test();
+    registerByteSize_test();
+    registerSchema_test();
     getString_test();
     getInteger_test();
     getFloat_test();
     getBoolean_test();
     getStringArray_test();
+    getStringView_test();
+    getStringArrayView_test();
+    sealConfig_test();
+    freezeConfig_test();
+    reloadConfig_test();
+    incrementalReload_test();
+    initOverlay_test();
+    configCache_test();
+    subscribe_test();
+    configSources_test();
+    environment_test();
+    includes_test();
+    parallelLoading_test();
+    accessStats_test();
+    loadProfile_test();
+    memoryUsage_test();
 
     cleanupTestCase();
 }
@@ -66,6 +97,38 @@ ConfigHandler_Test::readConfig_test()
     TEST_EQUAL(configHandler.initConfig(m_testFilePath, error), true);
 }
 
+/**
+ * @brief readConfigFile_test
+ */
+void
+ConfigHandler_Test::readConfigFile_test()
+{
+    ErrorContainer error;
+    std::string content = "";
+    const std::string emptyFilePath = "/tmp/ConfigHandler_Test_empty.ini";
+
+    TEST_EQUAL(ConfigHandler::readConfigFile(content, m_testFilePath, error), true);
+    TEST_EQUAL(content, getTestString());
+
+    // empty file
+    Kitsunemimi::writeFile(emptyFilePath, "", error, true);
+    TEST_EQUAL(ConfigHandler::readConfigFile(content, emptyFilePath, error), true);
+    TEST_EQUAL(content, "");
+
+    // file, which is larger than a single page
+    std::string largeContent = "[DEFAULT]\n";
+    while(largeContent.size() < 1000000) {
+        largeContent += "item_" + std::to_string(largeContent.size()) + " = value\n";
+    }
+    Kitsunemimi::writeFile(emptyFilePath, largeContent, error, true);
+    TEST_EQUAL(ConfigHandler::readConfigFile(content, emptyFilePath, error), true);
+    TEST_EQUAL(content, largeContent);
+    Kitsunemimi::deleteFileOrDir(emptyFilePath, error);
+
+    TEST_EQUAL(ConfigHandler::readConfigFile(content, "/tmp/asönganergupuneruigndf.ini", error),
+               false);
+}
+
 /**
  * @brief registerType_test
  */
@@ -124,6 +187,139 @@ ConfigHandler_Test::checkType_test()
     TEST_EQUAL(configHandler.checkType("asdf", "string_val", ConfigHandler::ConfigType::STRING_TYPE), true);
 }
 
+/**
+ * @brief hashGroups_test
+ */
+void
+ConfigHandler_Test::hashGroups_test()
+{
+    std::map<std::string, uint64_t> hashes;
+    const std::string content = "# comment\n"
+                                "[DEFAULT]\n"
+                                "int_val = 2\n"
+                                "[ other ]\n"
+                                "string_val = asdf\n"
+                                "[DEFAULT]\n"
+                                "float_val = 1.0";
+
+    ConfigHandler::hashGroups(content, hashes);
+    TEST_EQUAL(hashes.size(), 3);
+    TEST_EQUAL(hashes.count(""), 1);
+    TEST_EQUAL(hashes.count("other"), 1);
+
+    // change of one group doesn't change the hash of another group
+    std::map<std::string, uint64_t> newHashes;
+    std::string newContent = content;
+    newContent.replace(newContent.find("asdf"), 4, "poi");
+    ConfigHandler::hashGroups(newContent, newHashes);
+    TEST_EQUAL(newHashes["DEFAULT"], hashes["DEFAULT"]);
+    TEST_NOT_EQUAL(newHashes["other"], hashes["other"]);
+
+    // all sections of a group are extracted
+    TEST_EQUAL(ConfigHandler::extractGroups(content, {"DEFAULT"}),
+               "[DEFAULT]\n"
+               "int_val = 2\n"
+               "[DEFAULT]\n"
+               "float_val = 1.0\n");
+    TEST_EQUAL(ConfigHandler::extractGroups(content, {"fail"}), "");
+}
+
+/**
+ * @brief extractIncludes_test
+ */
+void
+ConfigHandler_Test::extractIncludes_test()
+{
+    std::vector<std::pair<std::string, std::string>> includes;
+    const std::string content = "include = base.ini\n"
+                                "# comment\n"
+                                "  include_dir = \"conf.d/*.ini\"  \n"
+                                "[DEFAULT]\n"
+                                "include = other.ini\n";
+
+    TEST_EQUAL(ConfigHandler::extractIncludes(content, includes),
+               "# comment\n[DEFAULT]\ninclude = other.ini\n");
+    TEST_EQUAL(includes.size(), 2);
+    TEST_EQUAL(includes[0].first, "include");
+    TEST_EQUAL(includes[0].second, "base.ini");
+    TEST_EQUAL(includes[1].first, "include_dir");
+    TEST_EQUAL(includes[1].second, "conf.d/*.ini");
+}
+
+/**
+ * @brief parseDuration_test
+ */
+void
+ConfigHandler_Test::parseDuration_test()
+{
+    long result = 0;
+
+    TEST_EQUAL(ConfigHandler::parseDuration("500ms", result), true);
+    TEST_EQUAL(result, 500000000l);
+    TEST_EQUAL(ConfigHandler::parseDuration("1h30m", result), true);
+    TEST_EQUAL(result, 5400000000000l);
+    TEST_EQUAL(ConfigHandler::parseDuration("2d12h", result), true);
+    TEST_EQUAL(result, 216000000000000l);
+    TEST_EQUAL(ConfigHandler::parseDuration("10us5ns", result), true);
+    TEST_EQUAL(result, 10005l);
+
+    // plain integer is taken as seconds
+    TEST_EQUAL(ConfigHandler::parseDuration("30", result), true);
+    TEST_EQUAL(result, 30000000000l);
+    TEST_EQUAL(ConfigHandler::parseDuration("0", result), true);
+    TEST_EQUAL(result, 0l);
+
+    // invalid or too big values
+    TEST_EQUAL(ConfigHandler::parseDuration("", result), false);
+    TEST_EQUAL(ConfigHandler::parseDuration("ms", result), false);
+    TEST_EQUAL(ConfigHandler::parseDuration("5x", result), false);
+    TEST_EQUAL(ConfigHandler::parseDuration("-5s", result), false);
+    TEST_EQUAL(ConfigHandler::parseDuration("1.5s", result), false);
+    TEST_EQUAL(ConfigHandler::parseDuration("1h30", result), false);
+    TEST_EQUAL(ConfigHandler::parseDuration("5 s", result), false);
+    TEST_EQUAL(ConfigHandler::parseDuration("300000d", result), false);
+    TEST_EQUAL(ConfigHandler::parseDuration("99999999999999999999ns", result), false);
+}
+
+/**
+ * @brief parseByteSize_test
+ */
+void
+ConfigHandler_Test::parseByteSize_test()
+{
+    long result = 0;
+
+    TEST_EQUAL(ConfigHandler::parseByteSize("64KiB", result), true);
+    TEST_EQUAL(result, 65536l);
+    TEST_EQUAL(ConfigHandler::parseByteSize("10MB", result), true);
+    TEST_EQUAL(result, 10000000l);
+    TEST_EQUAL(ConfigHandler::parseByteSize("1kB", result), true);
+    TEST_EQUAL(result, 1000l);
+    TEST_EQUAL(ConfigHandler::parseByteSize("1KB", result), true);
+    TEST_EQUAL(result, 1000l);
+    TEST_EQUAL(ConfigHandler::parseByteSize("2GiB", result), true);
+    TEST_EQUAL(result, 2147483648l);
+    TEST_EQUAL(ConfigHandler::parseByteSize("512B", result), true);
+    TEST_EQUAL(result, 512l);
+
+    // plain integer is taken as bytes
+    TEST_EQUAL(ConfigHandler::parseByteSize("4096", result), true);
+    TEST_EQUAL(result, 4096l);
+
+    // sizes above the maximum of long keep their unsigned bits
+    TEST_EQUAL(ConfigHandler::parseByteSize("16000PiB", result), true);
+    TEST_EQUAL(static_cast<uint64_t>(result), 16000ull << 50);
+
+    // invalid or too big values
+    TEST_EQUAL(ConfigHandler::parseByteSize("", result), false);
+    TEST_EQUAL(ConfigHandler::parseByteSize("KiB", result), false);
+    TEST_EQUAL(ConfigHandler::parseByteSize("10mb", result), false);
+    TEST_EQUAL(ConfigHandler::parseByteSize("10 MB", result), false);
+    TEST_EQUAL(ConfigHandler::parseByteSize("-1", result), false);
+    TEST_EQUAL(ConfigHandler::parseByteSize("1.5GB", result), false);
+    TEST_EQUAL(ConfigHandler::parseByteSize("20000PiB", result), false);
+}
+
 /**
  * @brief registerString_test
  */
@@ -135,10 +331,10 @@ ConfigHandler_Test::registerString_test()
 
     configHandler.initConfig(m_testFilePath, error);
 
-    configHandler.registerString("DEFAULT", "int_val", error, "default");
-    configHandler.registerString("DEFAULT", "itemName", error, "default");
-    configHandler.registerString("DEFAULT", "string_val", error, "default");
-    configHandler.registerString("DEFAULT", "string_val", error, "default");
+    TEST_EQUAL(configHandler.registerString("DEFAULT", "int_val", error, "default").isValid(), false);
+    TEST_EQUAL(configHandler.registerString("DEFAULT", "itemName", error, "default").isValid(), true);
+    TEST_EQUAL(configHandler.registerString("DEFAULT", "string_val", error, "default").isValid(), true);
+    TEST_EQUAL(configHandler.registerString("DEFAULT", "string_val", error, "default").isValid(), false);
 }
 
 /**
@@ -152,10 +348,10 @@ ConfigHandler_Test::registerInteger_test()
 
     configHandler.initConfig(m_testFilePath, error);
 
-    configHandler.registerInteger("DEFAULT", "string_val", error, 42);
-    configHandler.registerInteger("DEFAULT", "itemName", error, 42);
-    configHandler.registerInteger("DEFAULT", "int_val", error, 42);
-    configHandler.registerInteger("DEFAULT", "int_val", error, 42);
+    TEST_EQUAL(configHandler.registerInteger("DEFAULT", "string_val", error, 42).isValid(), false);
+    TEST_EQUAL(configHandler.registerInteger("DEFAULT", "itemName", error, 42).isValid(), true);
+    TEST_EQUAL(configHandler.registerInteger("DEFAULT", "int_val", error, 42).isValid(), true);
+    TEST_EQUAL(configHandler.registerInteger("DEFAULT", "int_val", error, 42).isValid(), false);
 }
 
 /**
@@ -169,10 +365,10 @@ ConfigHandler_Test::registerFloat_test()
 
     configHandler.initConfig(m_testFilePath, error);
 
-    configHandler.registerFloat("DEFAULT", "string_val", error, 42.0);
-    configHandler.registerFloat("DEFAULT", "itemName", error, 42.0);
-    configHandler.registerFloat("DEFAULT", "float_val", error, 42.0);
-    configHandler.registerFloat("DEFAULT", "float_val", error, 42.0);
+    TEST_EQUAL(configHandler.registerFloat("DEFAULT", "string_val", error, 42.0).isValid(), false);
+    TEST_EQUAL(configHandler.registerFloat("DEFAULT", "itemName", error, 42.0).isValid(), true);
+    TEST_EQUAL(configHandler.registerFloat("DEFAULT", "float_val", error, 42.0).isValid(), true);
+    TEST_EQUAL(configHandler.registerFloat("DEFAULT", "float_val", error, 42.0).isValid(), false);
 }
 
 /**
@@ -186,10 +382,10 @@ ConfigHandler_Test::registerBoolean_test()
 
     configHandler.initConfig(m_testFilePath, error);
 
-    configHandler.registerBoolean("DEFAULT", "string_val", error, true);
-    configHandler.registerBoolean("DEFAULT", "itemName", error, true);
-    configHandler.registerBoolean("DEFAULT", "bool_value", error, true);
-    configHandler.registerBoolean("DEFAULT", "bool_value", error, true);
+    TEST_EQUAL(configHandler.registerBoolean("DEFAULT", "string_val", error, true).isValid(), false);
+    TEST_EQUAL(configHandler.registerBoolean("DEFAULT", "itemName", error, true).isValid(), true);
+    TEST_EQUAL(configHandler.registerBoolean("DEFAULT", "bool_value", error, true).isValid(), true);
+    TEST_EQUAL(configHandler.registerBoolean("DEFAULT", "bool_value", error, true).isValid(), false);
 }
 
 /**
@@ -205,10 +401,283 @@ ConfigHandler_Test::registerStringArray_test()
     configHandler.initConfig(m_testFilePath, error);
     defaultValue.push_back("test");
 
-    configHandler.registerStringArray("DEFAULT", "string_val", error, defaultValue);
-    configHandler.registerStringArray("DEFAULT", "itemName", error, defaultValue);
-    configHandler.registerStringArray("DEFAULT", "string_list", error, defaultValue);
-    configHandler.registerStringArray("DEFAULT", "string_list", error, defaultValue);
+    TEST_EQUAL(configHandler.registerStringArray("DEFAULT", "string_val", error, defaultValue).isValid(), false);
+    TEST_EQUAL(configHandler.registerStringArray("DEFAULT", "itemName", error, defaultValue).isValid(), true);
+    TEST_EQUAL(configHandler.registerStringArray("DEFAULT", "string_list", error, defaultValue).isValid(), true);
+    TEST_EQUAL(configHandler.registerStringArray("DEFAULT", "string_list", error, defaultValue).isValid(), false);
+}
+
+/**
+ * @brief registerDuration_test
+ */
+void
+ConfigHandler_Test::registerDuration_test()
+{
+    bool success = false;
+    ErrorContainer error;
+    const std::string durationFilePath = "/tmp/ConfigHandler_Test_duration.ini";
+    const std::string cacheFilePath = "/tmp/ConfigHandler_Test_duration.cache";
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+    Kitsunemimi::writeFile(durationFilePath,
+                           "[DEFAULT]\n"
+                           "timeout = 1m30s\n"
+                           "plain = 5\n"
+                           "broken = 5parsecs\n"
+                           "flag = true\n",
+                           error,
+                           true);
+
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(durationFilePath, error, cacheFilePath);
+
+        ConfigKey<std::chrono::nanoseconds> key =
+                configHandler.registerDuration("DEFAULT", "timeout", error);
+        TEST_EQUAL(key.isValid(), true);
+        TEST_EQUAL(configHandler.registerDuration("DEFAULT", "plain", error).isValid(), true);
+        TEST_EQUAL(configHandler.registerDuration("DEFAULT",
+                                                  "missing",
+                                                  error,
+                                                  std::chrono::milliseconds(250)).isValid(),
+                   true);
+
+        // pre-converted values
+        TEST_EQUAL(configHandler.getDuration(key, success).count(), 90000000000l);
+        TEST_EQUAL(success, true);
+        TEST_EQUAL(configHandler.getDuration("DEFAULT", "plain", success).count(), 5000000000l);
+        TEST_EQUAL(configHandler.getDuration("DEFAULT", "missing", success).count(), 250000000l);
+        TEST_EQUAL(success, true);
+
+        // false type
+        TEST_EQUAL(configHandler.getInteger("DEFAULT", "timeout", success), 0);
+        TEST_EQUAL(success, false);
+        TEST_EQUAL(configHandler.getByteSize("DEFAULT", "timeout", success), 0);
+        TEST_EQUAL(success, false);
+
+        configHandler.sealConfig();
+        TEST_EQUAL(configHandler.isConfigValid(), true);
+
+        // reload converts the new value again
+        Kitsunemimi::writeFile(durationFilePath,
+                               "[DEFAULT]\n"
+                               "timeout = 2h\n"
+                               "plain = 5\n",
+                               error,
+                               true);
+        TEST_EQUAL(configHandler.reloadConfig(error), true);
+        TEST_EQUAL(configHandler.getDuration(key, success).count(), 7200000000000l);
+
+        // reload with a malformed unit keeps the old values
+        Kitsunemimi::writeFile(durationFilePath,
+                               "[DEFAULT]\n"
+                               "timeout = 2hours\n",
+                               error,
+                               true);
+        TEST_EQUAL(configHandler.reloadConfig(error), false);
+        TEST_EQUAL(configHandler.getDuration(key, success).count(), 7200000000000l);
+    }
+
+    // malformed unit makes the config invalid
+    {
+        Kitsunemimi::writeFile(durationFilePath,
+                               "[DEFAULT]\n"
+                               "timeout = 1m30s\n"
+                               "broken = 5parsecs\n"
+                               "flag = true\n",
+                               error,
+                               true);
+        ConfigHandler configHandler;
+        configHandler.initConfig(durationFilePath, error);
+
+        TEST_EQUAL(configHandler.registerDuration("DEFAULT", "flag", error).isValid(), false);
+        TEST_EQUAL(configHandler.registerDuration("DEFAULT", "broken", error).isValid(), false);
+        TEST_EQUAL(configHandler.isConfigValid(), false);
+    }
+
+    // values with a unit are restored from the cache
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(durationFilePath, error, cacheFilePath);
+        configHandler.registerDuration("DEFAULT", "timeout", error);
+        configHandler.sealConfig();
+    }
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(durationFilePath, error, cacheFilePath);
+        const bool cacheUsed = configHandler.m_configCache != nullptr;
+        TEST_EQUAL(cacheUsed, true);
+
+        ConfigKey<std::chrono::nanoseconds> key =
+                configHandler.registerDuration("DEFAULT", "timeout", error);
+        TEST_EQUAL(configHandler.m_iniItem, nullptr);
+        TEST_EQUAL(configHandler.getDuration(key, success).count(), 90000000000l);
+
+        // same item with another type can not be taken from the cache
+        ConfigHandler otherHandler;
+        otherHandler.initConfig(durationFilePath, error, cacheFilePath);
+        TEST_EQUAL(otherHandler.registerByteSize("DEFAULT", "timeout", error).isValid(), false);
+    }
+
+    Kitsunemimi::deleteFileOrDir(durationFilePath, error);
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+}
+
+/**
+ * @brief registerByteSize_test
+ */
+void
+ConfigHandler_Test::registerByteSize_test()
+{
+    bool success = false;
+    ErrorContainer error;
+    const std::string sizeFilePath = "/tmp/ConfigHandler_Test_size.ini";
+    Kitsunemimi::writeFile(sizeFilePath,
+                           "[DEFAULT]\n"
+                           "buffer = 64KiB\n"
+                           "plain = 4096\n"
+                           "broken = 10mb\n",
+                           error,
+                           true);
+
+    ConfigHandler configHandler;
+    configHandler.initConfig(sizeFilePath, error);
+
+    ConfigKey<uint64_t> key = configHandler.registerByteSize("DEFAULT", "buffer", error);
+    TEST_EQUAL(key.isValid(), true);
+    TEST_EQUAL(configHandler.registerByteSize("DEFAULT", "plain", error).isValid(), true);
+    TEST_EQUAL(configHandler.registerSchema(
+                   {ConfigSpec::forByteSize("DEFAULT", "missing", 1ull << 40),
+                    ConfigSpec::forDuration("DEFAULT", "interval", std::chrono::seconds(3))},
+                   error),
+               true);
+
+    TEST_EQUAL(configHandler.getByteSize(key, success), 65536);
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(configHandler.getByteSize("DEFAULT", "plain", success), 4096);
+    TEST_EQUAL(configHandler.getByteSize("DEFAULT", "missing", success), 1ull << 40);
+    TEST_EQUAL(configHandler.getDuration("DEFAULT", "interval", success).count(), 3000000000l);
+    TEST_EQUAL(success, true);
+
+    // values with a unit share the list of the integers
+    ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error, 7);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 7);
+    TEST_EQUAL(configHandler.getByteSize(key, success), 65536);
+
+    TEST_EQUAL(configHandler.isConfigValid(), true);
+    TEST_EQUAL(configHandler.registerByteSize("DEFAULT", "broken", error).isValid(), false);
+    TEST_EQUAL(configHandler.isConfigValid(), false);
+
+    Kitsunemimi::deleteFileOrDir(sizeFilePath, error);
+}
+
+/**
+ * @brief registerSchema_test
+ */
+void
+ConfigHandler_Test::registerSchema_test()
+{
+    bool success = false;
+    ErrorContainer error;
+
+    // valid schema
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(m_testFilePath, error);
+
+        const std::vector<ConfigSpec> schema = {
+            ConfigSpec::forInteger("DEFAULT", "int_val", 42, true),
+            ConfigSpec::forString("", "string_val"),
+            ConfigSpec::forFloat("DEFAULT", "float_val"),
+            ConfigSpec::forBoolean("DEFAULT", "bool_value"),
+            ConfigSpec::forStringArray("DEFAULT", "string_list"),
+            ConfigSpec::forInteger("other_group", "int_val", 43),
+        };
+        std::vector<uint32_t> indexes;
+        TEST_EQUAL(configHandler.registerSchema(schema, error, indexes), true);
+        TEST_EQUAL(configHandler.isConfigValid(), true);
+
+        // indexes are in order of the schema and can be used as handles
+        TEST_EQUAL(indexes.size(), schema.size());
+        TEST_EQUAL(configHandler.getInteger(ConfigKey<long>{indexes[0]}, success), 2);
+        TEST_EQUAL(configHandler.getString(ConfigKey<std::string>{indexes[1]}, success),
+                   "asdf.asdf");
+        TEST_EQUAL(configHandler.getInteger(ConfigKey<long>{indexes[5]}, success), 43);
+
+        TEST_EQUAL(configHandler.getInteger("DEFAULT", "int_val", success), 2);
+        TEST_EQUAL(configHandler.getString("DEFAULT", "string_val", success), "asdf.asdf");
+        TEST_EQUAL(configHandler.getFloat("DEFAULT", "float_val", success), 123.0);
+        TEST_EQUAL(configHandler.getBoolean("DEFAULT", "bool_value", success), true);
+        TEST_EQUAL(configHandler.getStringArray("DEFAULT", "string_list", success).size(), 3);
+        TEST_EQUAL(configHandler.getInteger("other_group", "int_val", success), 43);
+        TEST_EQUAL(success, true);
+
+        // schema after single registration
+        TEST_EQUAL(configHandler.registerSchema({ConfigSpec::forInteger("DEFAULT", "int_val")},
+                                                error),
+                   false);
+
+        // schema after seal
+        configHandler.sealConfig();
+        TEST_EQUAL(configHandler.registerSchema({ConfigSpec::forInteger("DEFAULT", "x")}, error),
+                   false);
+    }
+
+    // all failed items are reported, all other items are registered nevertheless
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(m_testFilePath, error);
+
+        const std::vector<ConfigSpec> schema = {
+            ConfigSpec::forInteger("DEFAULT", "string_val"),
+            ConfigSpec::forInteger("DEFAULT", "int_val"),
+            ConfigSpec::forInteger("DEFAULT", "int_val"),
+            ConfigSpec::forInteger("DEFAULT", "missing_val", 0, true),
+            ConfigSpec(),
+            ConfigSpec::forBoolean("DEFAULT", "bool_value"),
+        };
+        ErrorContainer schemaError;
+        std::vector<uint32_t> indexes;
+        TEST_EQUAL(configHandler.registerSchema(schema, schemaError, indexes), false);
+        TEST_EQUAL(configHandler.isConfigValid(), false);
+        TEST_EQUAL(schemaError._errorMessages.size(), 4);
+        TEST_EQUAL(indexes[0], UNREGISTERED_CONFIG_KEY);
+        TEST_EQUAL(indexes[2], UNREGISTERED_CONFIG_KEY);
+        TEST_EQUAL(indexes[3], UNREGISTERED_CONFIG_KEY);
+        TEST_EQUAL(indexes[4], UNREGISTERED_CONFIG_KEY);
+        TEST_EQUAL(configHandler.getInteger(ConfigKey<long>{indexes[1]}, success), 2);
+        TEST_EQUAL(configHandler.getBoolean(ConfigKey<bool>{indexes[5]}, success), true);
+
+        TEST_EQUAL(configHandler.isRegistered("DEFAULT", "string_val"), false);
+        TEST_EQUAL(configHandler.isRegistered("DEFAULT", "missing_val"), false);
+        TEST_EQUAL(configHandler.getInteger("DEFAULT", "int_val", success), 2);
+        TEST_EQUAL(configHandler.getBoolean("DEFAULT", "bool_value", success), true);
+        TEST_EQUAL(success, true);
+    }
+
+    // items with a broken value in the environment are not registered
+    {
+        setenv("KITSUNEMIMI_DEFAULT_INT_VAL", "4\n2", 1);
+        ConfigSources sources;
+        sources.addFile(m_testFilePath);
+        sources.addEnvironment();
+
+        ConfigHandler configHandler;
+        configHandler.initConfig(sources, error);
+        unsetenv("KITSUNEMIMI_DEFAULT_INT_VAL");
+
+        const std::vector<ConfigSpec> schema = {
+            ConfigSpec::forInteger("DEFAULT", "int_val"),
+            ConfigSpec::forBoolean("DEFAULT", "bool_value"),
+        };
+        ErrorContainer schemaError;
+        std::vector<uint32_t> indexes;
+        TEST_EQUAL(configHandler.registerSchema(schema, schemaError, indexes), false);
+        TEST_EQUAL(configHandler.isConfigValid(), false);
+        TEST_EQUAL(configHandler.isRegistered("DEFAULT", "int_val"), false);
+        TEST_EQUAL(indexes[0], UNREGISTERED_CONFIG_KEY);
+        TEST_EQUAL(configHandler.getBoolean(ConfigKey<bool>{indexes[1]}, success), true);
+        TEST_EQUAL(success, true);
+    }
 }
 
 /**
@@ -227,12 +696,17 @@ ConfigHandler_Test::getString_test()
     TEST_EQUAL(configHandler.getString("DEFAULT", "string_val", success), "");
     TEST_EQUAL(success, false);
 
-    configHandler.registerString("DEFAULT", "string_val", error, "xyz");
+    ConfigKey<std::string> key = configHandler.registerString("DEFAULT", "string_val", error, "xyz");
 
     // successful test
     TEST_EQUAL(configHandler.getString("DEFAULT", "string_val", success), "asdf.asdf");
     TEST_EQUAL(success, true);
 
+    // lookup with views, which are not null-terminated
+    const std::string_view names = "DEFAULTstring_val";
+    TEST_EQUAL(configHandler.getString(names.substr(0, 7), names.substr(7), success), "asdf.asdf");
+    TEST_EQUAL(success, true);
+
     // test false type
     TEST_EQUAL(configHandler.getInteger("DEFAULT", "string_val", success), 0);
     TEST_EQUAL(success, false);
@@ -242,6 +716,14 @@ ConfigHandler_Test::getString_test()
     // test default
     TEST_EQUAL(configHandler.getString("DEFAULT", "string_val2", success), "xyz");
     TEST_EQUAL(success, true);
+
+    // test handle
+    TEST_EQUAL(configHandler.getString(key, success), "asdf.asdf");
+    TEST_EQUAL(success, true);
+
+    // test invalid handle
+    TEST_EQUAL(configHandler.getInteger(ConfigKey<long>(), success), 0);
+    TEST_EQUAL(success, false);
 }
 
 /**
@@ -260,7 +742,7 @@ ConfigHandler_Test::getInteger_test()
     TEST_EQUAL(configHandler.getInteger("DEFAULT", "int_val", success), 0);
     TEST_EQUAL(success, false);
 
-    configHandler.registerInteger("DEFAULT", "int_val", error, 42);
+    ConfigKey<long> key = configHandler.registerInteger("DEFAULT", "int_val", error, 42);
 
     // successful test
     TEST_EQUAL(configHandler.getInteger("DEFAULT", "int_val", success), 2);
@@ -275,6 +757,14 @@ ConfigHandler_Test::getInteger_test()
     // test default
     TEST_EQUAL(configHandler.getInteger("DEFAULT", "int_val2", success), 42);
     TEST_EQUAL(success, true);
+
+    // test handle
+    TEST_EQUAL(configHandler.getInteger(key, success), 2);
+    TEST_EQUAL(success, true);
+
+    // test invalid handle
+    TEST_EQUAL(configHandler.getString(ConfigKey<std::string>(), success), "");
+    TEST_EQUAL(success, false);
 }
 
 /**
@@ -293,7 +783,7 @@ ConfigHandler_Test::getFloat_test()
     TEST_EQUAL(configHandler.getFloat("DEFAULT", "float_val", success), 0.0);
     TEST_EQUAL(success, false);
 
-    configHandler.registerFloat("DEFAULT", "float_val", error, 42.0);
+    ConfigKey<double> key = configHandler.registerFloat("DEFAULT", "float_val", error, 42.0);
 
     // successful test
     TEST_EQUAL(configHandler.getFloat("DEFAULT", "float_val", success), 123.0);
@@ -308,6 +798,14 @@ ConfigHandler_Test::getFloat_test()
     // test default
     TEST_EQUAL(configHandler.getFloat("DEFAULT", "float_val2", success), 42.0);
     TEST_EQUAL(success, true);
+
+    // test handle
+    TEST_EQUAL(configHandler.getFloat(key, success), 123.0);
+    TEST_EQUAL(success, true);
+
+    // test invalid handle
+    TEST_EQUAL(configHandler.getFloat(ConfigKey<double>(), success), 0.0);
+    TEST_EQUAL(success, false);
 }
 
 /**
@@ -326,7 +824,7 @@ ConfigHandler_Test::getBoolean_test()
     TEST_EQUAL(configHandler.getBoolean("DEFAULT", "bool_value", success), false);
     TEST_EQUAL(success, false);
 
-    configHandler.registerBoolean("DEFAULT", "bool_value", error, false);
+    ConfigKey<bool> key = configHandler.registerBoolean("DEFAULT", "bool_value", error, false);
 
     // successful test
     TEST_EQUAL(configHandler.getBoolean("DEFAULT", "bool_value", success), true);
@@ -341,6 +839,14 @@ ConfigHandler_Test::getBoolean_test()
     // test default
     TEST_EQUAL(configHandler.getBoolean("DEFAULT", "bool_value2", success), true);
     TEST_EQUAL(success, true);
+
+    // test handle
+    TEST_EQUAL(configHandler.getBoolean(key, success), true);
+    TEST_EQUAL(success, true);
+
+    // test invalid handle
+    TEST_EQUAL(configHandler.getBoolean(ConfigKey<bool>(), success), false);
+    TEST_EQUAL(success, false);
 }
 
 /**
@@ -363,7 +869,8 @@ ConfigHandler_Test::getStringArray_test()
     TEST_EQUAL(ret.size(), 0);
     TEST_EQUAL(success, false);
 
-    configHandler.registerStringArray("DEFAULT", "string_list", error, defaultValue);
+    ConfigKey<std::vector<std::string>> key =
+            configHandler.registerStringArray("DEFAULT", "string_list", error, defaultValue);
 
     // successful test
     ret = configHandler.getStringArray("DEFAULT", "string_list", success);
@@ -380,6 +887,999 @@ ConfigHandler_Test::getStringArray_test()
     ret = configHandler.getStringArray("DEFAULT", "string_list2", success);
     TEST_EQUAL(ret.size(), 1);
     TEST_EQUAL(success, true);
+
+    // test handle
+    ret = configHandler.getStringArray(key, success);
+    TEST_EQUAL(ret.size(), 3);
+    TEST_EQUAL(success, true);
+
+    // test invalid handle
+    ret = configHandler.getStringArray(ConfigKey<std::vector<std::string>>(), success);
+    TEST_EQUAL(ret.size(), 0);
+    TEST_EQUAL(success, false);
+}
+
+/**
+ * @brief getStringView_test
+ */
+void
+ConfigHandler_Test::getStringView_test()
+{
+    ConfigHandler configHandler;
+    bool success = false;
+    ErrorContainer error;
+
+    configHandler.initConfig(m_testFilePath, error);
+
+    // test if unregistered
+    TEST_EQUAL(configHandler.getStringView("DEFAULT", "string_val", success), "");
+    TEST_EQUAL(success, false);
+
+    ConfigKey<std::string> key = configHandler.registerString("DEFAULT", "string_val", error);
+    configHandler.registerInteger("DEFAULT", "int_val", error);
+
+    // test before seal, because further registrations could still move the value
+    TEST_EQUAL(configHandler.getStringView("DEFAULT", "string_val", success), "");
+    TEST_EQUAL(success, false);
+    TEST_EQUAL(configHandler.getStringView(key, success), "");
+    TEST_EQUAL(success, false);
+    {
+        ConfigHandler::SnapshotReader reader(&configHandler);
+        TEST_EQUAL(reader.getStringView(key, success), "");
+        TEST_EQUAL(success, false);
+        TEST_EQUAL(reader.getString(key, success), "asdf.asdf");
+        TEST_EQUAL(success, true);
+    }
+
+    // a larger registration moves the stored strings, but views are only handed out after the
+    // seal, when no registration can move them anymore
+    configHandler.registerString("DEFAULT", "another_string", error, std::string(4096, 'x'));
+    configHandler.sealConfig();
+    const std::string_view view = configHandler.getStringView(key, success);
+    TEST_EQUAL(success, true);
+
+    // successful test
+    TEST_EQUAL(configHandler.getStringView("DEFAULT", "string_val", success), "asdf.asdf");
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(configHandler.getStringView(key, success), "asdf.asdf");
+    TEST_EQUAL(success, true);
+
+    // test false type
+    TEST_EQUAL(configHandler.getStringView("DEFAULT", "int_val", success), "");
+    TEST_EQUAL(success, false);
+
+    // test invalid handle
+    TEST_EQUAL(configHandler.getStringView(ConfigKey<std::string>(), success), "");
+    TEST_EQUAL(success, false);
+
+    // test pinned reader
+    ConfigHandler::SnapshotReader reader(&configHandler);
+    TEST_EQUAL(reader.getStringView(key, success), "asdf.asdf");
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(view, "asdf.asdf");
+}
+
+/**
+ * @brief getStringArrayView_test
+ */
+void
+ConfigHandler_Test::getStringArrayView_test()
+{
+    ConfigHandler configHandler;
+    bool success = false;
+    ErrorContainer error;
+    StringArrayView view;
+
+    configHandler.initConfig(m_testFilePath, error);
+
+    // test if unregistered
+    view = configHandler.getStringArrayView("DEFAULT", "string_list", success);
+    TEST_EQUAL(view.size(), 0);
+    TEST_EQUAL(success, false);
+
+    ConfigKey<std::vector<std::string>> key =
+            configHandler.registerStringArray("DEFAULT", "string_list", error);
+    configHandler.registerStringArray("DEFAULT", "string_list2", error, {"x", "y"});
+
+    // test before seal, because further registrations could still move the elements
+    view = configHandler.getStringArrayView("DEFAULT", "string_list", success);
+    TEST_EQUAL(view.empty(), true);
+    TEST_EQUAL(success, false);
+    view = configHandler.getStringArrayView(key, success);
+    TEST_EQUAL(view.empty(), true);
+    TEST_EQUAL(success, false);
+    {
+        ConfigHandler::SnapshotReader reader(&configHandler);
+        TEST_EQUAL(reader.getStringArrayView(key, success).empty(), true);
+        TEST_EQUAL(success, false);
+        TEST_EQUAL(reader.getStringArray(key, success).size(), 3);
+        TEST_EQUAL(success, true);
+    }
+
+    // many more elements move the element-list and the characters before the seal
+    configHandler.registerStringArray("DEFAULT",
+                                      "string_list3",
+                                      error,
+                                      std::vector<std::string>(1000, std::string(64, 'x')));
+    configHandler.sealConfig();
+
+    // successful test
+    view = configHandler.getStringArrayView("DEFAULT", "string_list", success);
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(view.size(), 3);
+    TEST_EQUAL(view[0], "a");
+    TEST_EQUAL(view[2], "c");
+
+    view = configHandler.getStringArrayView(key, success);
+    TEST_EQUAL(success, true);
+    std::string joined = "";
+    for(const std::string_view element : view) {
+        joined += element;
+    }
+    TEST_EQUAL(joined, "abc");
+
+    // test default
+    view = configHandler.getStringArrayView("DEFAULT", "string_list2", success);
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(view.size(), 2);
+    TEST_EQUAL(view[1], "y");
+
+    // test invalid handle
+    view = configHandler.getStringArrayView(ConfigKey<std::vector<std::string>>(), success);
+    TEST_EQUAL(view.empty(), true);
+    TEST_EQUAL(success, false);
+}
+
+/**
+ * @brief sealConfig_test
+ */
+void
+ConfigHandler_Test::sealConfig_test()
+{
+    ConfigHandler configHandler;
+    bool success = false;
+    ErrorContainer error;
+
+    configHandler.initConfig(m_testFilePath, error);
+
+    ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error, 42);
+    ConfigKey<bool> boolKey = configHandler.registerBoolean("DEFAULT", "bool_value", error);
+    configHandler.registerStringArray("DEFAULT", "string_list", error);
+
+    configHandler.sealConfig();
+    TEST_EQUAL(configHandler.m_iniItem, nullptr);
+
+    // values must be readable after sealing
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(configHandler.getBoolean(boolKey, success), true);
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(configHandler.getStringArray("DEFAULT", "string_list", success).size(), 3);
+    TEST_EQUAL(success, true);
+
+    // no registration after sealing
+    TEST_EQUAL(configHandler.isConfigValid(), true);
+    TEST_EQUAL(configHandler.registerString("DEFAULT", "string_val", error).isValid(), false);
+    TEST_EQUAL(configHandler.isConfigValid(), false);
+}
+
+/**
+ * @brief freezeConfig_test
+ */
+void
+ConfigHandler_Test::freezeConfig_test()
+{
+    bool success = false;
+    ErrorContainer error;
+
+    ConfigHandler configHandler;
+    configHandler.initConfig(m_testFilePath, error);
+    const ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+    const ConfigKey<std::string> stringKey = configHandler.registerString("DEFAULT",
+                                                                          "string_val",
+                                                                          error);
+    configHandler.freezeConfig();
+
+    // frozen config is also sealed
+    TEST_EQUAL(configHandler.registerInteger("DEFAULT", "another_int", error).index,
+               UNREGISTERED_CONFIG_KEY);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(configHandler.getInteger("DEFAULT", "int_val", success), 2);
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(configHandler.getStringView(stringKey, success), "asdf.asdf");
+    TEST_EQUAL(success, true);
+    TEST_EQUAL(configHandler.getInteger(ConfigKey<long>(), success), 0);
+    TEST_EQUAL(success, false);
+
+    // readers of a frozen config are not counted
+    {
+        ConfigHandler::SnapshotReader reader(&configHandler);
+        TEST_EQUAL(reader.getInteger(intKey, success), 2);
+        TEST_EQUAL(success, true);
+
+        uint64_t activeReaders = 0;
+        for(uint32_t epoch = 0; epoch < 2; epoch++)
+        {
+            for(uint32_t shard = 0; shard < NUMBER_OF_READER_SHARDS; shard++) {
+                activeReaders += configHandler.m_activeReaders[epoch][shard].count.load();
+            }
+        }
+        TEST_EQUAL(activeReaders, 0);
+    }
+
+    // a frozen config can not be reloaded anymore
+    TEST_EQUAL(configHandler.reloadConfig(error), false);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+}
+
+/**
+ * @brief reloadConfig_test
+ */
+void
+ConfigHandler_Test::reloadConfig_test()
+{
+    ConfigHandler configHandler;
+    bool success = false;
+    ErrorContainer error;
+    const std::string reloadFilePath = "/tmp/ConfigHandler_Test_reload.ini";
+
+    Kitsunemimi::writeFile(reloadFilePath, getTestString(), error, true);
+    configHandler.initConfig(reloadFilePath, error);
+
+    ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error, 42);
+    ConfigKey<long> defaultKey = configHandler.registerInteger("DEFAULT", "int_val2", error, 42);
+    ConfigKey<std::string> stringKey = configHandler.registerString("DEFAULT", "string_val", error);
+
+    // reload is only allowed for sealed configs
+    TEST_EQUAL(configHandler.reloadConfig(error), false);
+    configHandler.sealConfig();
+
+    // reload with changed values
+    Kitsunemimi::writeFile(reloadFilePath,
+                           "[DEFAULT]\n"
+                           "string_val = poi\n"
+                           "int_val = 5\n",
+                           error,
+                           true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 5);
+    TEST_EQUAL(configHandler.getInteger(defaultKey, success), 42);
+    TEST_EQUAL(configHandler.getString(stringKey, success), "poi");
+    TEST_EQUAL(configHandler.getInteger("DEFAULT", "int_val", success), 5);
+
+    // reload with false type must keep the old values
+    Kitsunemimi::writeFile(reloadFilePath,
+                           "[DEFAULT]\n"
+                           "string_val = poi\n"
+                           "int_val = asdf\n",
+                           error,
+                           true);
+    TEST_EQUAL(configHandler.reloadConfig(error), false);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 5);
+    TEST_EQUAL(configHandler.isConfigValid(), true);
+
+    Kitsunemimi::deleteFileOrDir(reloadFilePath, error);
+}
+
+/**
+ * @brief incrementalReload_test
+ */
+void
+ConfigHandler_Test::incrementalReload_test()
+{
+    ConfigHandler configHandler;
+    bool success = false;
+    ErrorContainer error;
+    const std::string reloadFilePath = "/tmp/ConfigHandler_Test_incremental.ini";
+
+    Kitsunemimi::writeFile(reloadFilePath,
+                           "[DEFAULT]\n"
+                           "int_val = 2\n"
+                           "\n"
+                           "[other]\n"
+                           "string_val = asdf\n",
+                           error,
+                           true);
+    configHandler.initConfig(reloadFilePath, error);
+    ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+    ConfigKey<std::string> stringKey = configHandler.registerString("other", "string_val", error);
+    ConfigKey<std::string> secondKey = configHandler.registerString("other",
+                                                                      "string_val2",
+                                                                      error,
+                                                                      "default");
+    configHandler.sealConfig();
+    TEST_EQUAL(configHandler.m_groupHashes.size(), 2);
+
+    // unchanged file doesn't create new values
+    const ConfigSnapshot* oldSnapshot = configHandler.m_snapshot.load();
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(configHandler.m_snapshot.load(), oldSnapshot);
+
+    // only changed group is updated, the other values are taken over
+    Kitsunemimi::writeFile(reloadFilePath,
+                           "[DEFAULT]\n"
+                           "int_val = 2\n"
+                           "\n"
+                           "[other]\n"
+                           "string_val = poi\n"
+                           "string_val2 = xyz\n",
+                           error,
+                           true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+    TEST_EQUAL(configHandler.getString(stringKey, success), "poi");
+    TEST_EQUAL(configHandler.getString(secondKey, success), "xyz");
+
+    // removed group falls back to the defaults
+    Kitsunemimi::writeFile(reloadFilePath,
+                           "[DEFAULT]\n"
+                           "int_val = 3\n",
+                           error,
+                           true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 3);
+    TEST_EQUAL(configHandler.getString(stringKey, success), "");
+    TEST_EQUAL(configHandler.getString(secondKey, success), "default");
+
+    // invalid changed group keeps the old values and hashes
+    Kitsunemimi::writeFile(reloadFilePath,
+                           "[DEFAULT]\n"
+                           "int_val = asdf\n",
+                           error,
+                           true);
+    TEST_EQUAL(configHandler.reloadConfig(error), false);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 3);
+    Kitsunemimi::writeFile(reloadFilePath,
+                           "[DEFAULT]\n"
+                           "int_val = 3\n",
+                           error,
+                           true);
+    oldSnapshot = configHandler.m_snapshot.load();
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(configHandler.m_snapshot.load(), oldSnapshot);
+
+    Kitsunemimi::deleteFileOrDir(reloadFilePath, error);
+}
+
+/**
+ * @brief initOverlay_test
+ */
+void
+ConfigHandler_Test::initOverlay_test()
+{
+    bool success = false;
+    ErrorContainer error;
+    const std::string overlayFilePath = "/tmp/ConfigHandler_Test_overlay.ini";
+    Kitsunemimi::writeFile(overlayFilePath,
+                           "[DEFAULT]\n"
+                           "int_val = 5\n"
+                           "unknown_val = 1\n"
+                           "\n"
+                           "[other]\n"
+                           "string_val = poi\n",
+                           error,
+                           true);
+
+    ConfigHandler base;
+    base.initConfig(m_testFilePath, error);
+    ConfigKey<long> intKey = base.registerInteger("DEFAULT", "int_val", error);
+    ConfigKey<std::string> stringKey = base.registerString("DEFAULT", "string_val", error);
+    base.registerString("other", "string_val", error, "default");
+
+    // base must be sealed
+    ConfigHandler unsealedOverlay;
+    TEST_EQUAL(unsealedOverlay.initOverlay(base, overlayFilePath, error), false);
+    base.sealConfig();
+
+    {
+        ConfigHandler overlay;
+        TEST_EQUAL(overlay.initOverlay(base, overlayFilePath, error), true);
+        TEST_EQUAL(overlay.isConfigValid(), true);
+        TEST_EQUAL(base.m_numberOfOverlays.load(), 1);
+
+        // overridden values and values of the base, also with the handles of the base
+        TEST_EQUAL(overlay.getInteger(intKey, success), 5);
+        TEST_EQUAL(overlay.getInteger("DEFAULT", "int_val", success), 5);
+        TEST_EQUAL(overlay.getString(stringKey, success), "asdf.asdf");
+        TEST_EQUAL(overlay.getString("other", "string_val", success), "poi");
+        TEST_EQUAL(base.getInteger(intKey, success), 2);
+        TEST_EQUAL(base.getString("other", "string_val", success), "default");
+
+        // overlays are sealed and have no own registrations
+        TEST_EQUAL(overlay.registerInteger("DEFAULT", "new_val", error).isValid(), false);
+        TEST_EQUAL(overlay.initOverlay(base, overlayFilePath, error), false);
+
+        // base is immutable as long as overlays exist
+        TEST_EQUAL(base.reloadConfig(error), false);
+
+        // overlay can reload its own values
+        Kitsunemimi::writeFile(overlayFilePath, "[DEFAULT]\nint_val = 7\n", error, true);
+        TEST_EQUAL(overlay.reloadConfig(error), true);
+        TEST_EQUAL(overlay.getInteger(intKey, success), 7);
+        TEST_EQUAL(overlay.getString("other", "string_val", success), "default");
+
+        // false type in the overlay
+        Kitsunemimi::writeFile(overlayFilePath, "[DEFAULT]\nint_val = asdf\n", error, true);
+        TEST_EQUAL(overlay.reloadConfig(error), false);
+        TEST_EQUAL(overlay.getInteger(intKey, success), 7);
+        ConfigHandler brokenOverlay;
+        TEST_EQUAL(brokenOverlay.initOverlay(base, overlayFilePath, error), false);
+    }
+
+    TEST_EQUAL(base.m_numberOfOverlays.load(), 0);
+    TEST_EQUAL(base.reloadConfig(error), true);
+
+    Kitsunemimi::deleteFileOrDir(overlayFilePath, error);
+}
+
+/**
+ * @brief configCache_test
+ */
+void
+ConfigHandler_Test::configCache_test()
+{
+    bool success = false;
+    ErrorContainer error;
+    const std::string cacheFilePath = "/tmp/ConfigHandler_Test.cache";
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+
+    // first start without cache has to parse the file and writes the cache
+    {
+        ConfigHandler configHandler;
+        TEST_EQUAL(configHandler.initConfig(m_testFilePath, error, cacheFilePath), true);
+        TEST_EQUAL(configHandler.m_configCache, nullptr);
+        TEST_NOT_EQUAL(configHandler.m_iniItem, nullptr);
+
+        configHandler.registerInteger("DEFAULT", "int_val", error, 42, true);
+        configHandler.registerInteger("DEFAULT", "int_val2", error, 42);
+        configHandler.registerStringArray("DEFAULT", "string_list", error);
+        configHandler.sealConfig();
+    }
+
+    // second start takes all values from the cache without parsing the file
+    {
+        ConfigHandler configHandler;
+        TEST_EQUAL(configHandler.initConfig(m_testFilePath, error, cacheFilePath), true);
+        TEST_NOT_EQUAL(configHandler.m_configCache, nullptr);
+        TEST_EQUAL(configHandler.m_iniItem, nullptr);
+
+        ConfigKey<long> intKey =
+                configHandler.registerInteger("DEFAULT", "int_val", error, 42, true);
+        ConfigKey<long> defaultKey =
+                configHandler.registerInteger("DEFAULT", "int_val2", error, 43);
+        ConfigKey<std::vector<std::string>> arrayKey =
+                configHandler.registerStringArray("DEFAULT", "string_list", error);
+        TEST_EQUAL(configHandler.m_iniItem, nullptr);
+
+        // changed default-value is used nevertheless
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+        TEST_EQUAL(configHandler.getInteger(defaultKey, success), 43);
+        TEST_EQUAL(configHandler.getStringArray(arrayKey, success).size(), 3);
+
+        configHandler.sealConfig();
+        TEST_EQUAL(configHandler.isConfigValid(), true);
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+    }
+
+    // registration, which is not in the cache, falls back to the parsed file
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(m_testFilePath, error, cacheFilePath);
+
+        ConfigKey<long> intKey =
+                configHandler.registerInteger("DEFAULT", "int_val", error, 42, true);
+        ConfigKey<double> floatKey = configHandler.registerFloat("DEFAULT", "float_val", error);
+        TEST_EQUAL(configHandler.m_configCache, nullptr);
+        TEST_NOT_EQUAL(configHandler.m_iniItem, nullptr);
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+        TEST_EQUAL(configHandler.getFloat(floatKey, success), 123.0);
+
+        // checks are active again after the fallback
+        TEST_EQUAL(configHandler.registerInteger("DEFAULT", "bool_value", error).isValid(), false);
+        TEST_EQUAL(configHandler.isConfigValid(), false);
+    }
+
+    // changed config-file doesn't use the cache
+    {
+        const std::string otherFilePath = "/tmp/ConfigHandler_Test_cache.ini";
+        Kitsunemimi::writeFile(otherFilePath, "[DEFAULT]\nint_val = 5\n", error, true);
+
+        ConfigHandler configHandler;
+        configHandler.initConfig(otherFilePath, error, cacheFilePath);
+        TEST_EQUAL(configHandler.m_configCache, nullptr);
+
+        ConfigKey<long> intKey =
+                configHandler.registerInteger("DEFAULT", "int_val", error, 42, true);
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 5);
+
+        Kitsunemimi::deleteFileOrDir(otherFilePath, error);
+    }
+
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+}
+
+/**
+ * @brief subscribe_test
+ */
+void
+ConfigHandler_Test::subscribe_test()
+{
+    ConfigHandler configHandler;
+    ErrorContainer error;
+    const std::string reloadFilePath = "/tmp/ConfigHandler_Test_subscribe.ini";
+
+    Kitsunemimi::writeFile(reloadFilePath, getTestString(), error, true);
+    configHandler.initConfig(reloadFilePath, error);
+    configHandler.registerString("DEFAULT", "string_val", error);
+    configHandler.registerInteger("DEFAULT", "int_val", error);
+    configHandler.registerFloat("DEFAULT", "float_val", error);
+    configHandler.registerStringArray("DEFAULT", "string_list", error);
+    configHandler.sealConfig();
+
+    uint32_t intCalls = 0;
+    uint32_t floatCalls = 0;
+    uint32_t groupCalls = 0;
+    std::vector<ConfigChange> groupChanges;
+
+    // only registered items can be subscribed
+    TEST_EQUAL(configHandler.subscribe("DEFAULT", "fail", [](const std::vector<ConfigChange>&){}),
+               0);
+    TEST_EQUAL(configHandler.subscribeGroup("fail", [](const std::vector<ConfigChange>&){}), 0);
+    TEST_EQUAL(configHandler.subscribeGroup("int_val", [](const std::vector<ConfigChange>&){}), 0);
+
+    // empty group-name is the default-group
+    uint32_t defaultCalls = 0;
+    configHandler.subscribe("",
+                            "int_val",
+                            [&defaultCalls](const std::vector<ConfigChange>&) { defaultCalls++; });
+    configHandler.subscribeGroup("",
+                                 [&defaultCalls](const std::vector<ConfigChange>&)
+    {
+        defaultCalls++;
+    });
+
+    const uint64_t intId = configHandler.subscribe(
+                "DEFAULT",
+                "int_val",
+                [&intCalls](const std::vector<ConfigChange>&) { intCalls++; });
+    configHandler.subscribe("DEFAULT",
+                            "float_val",
+                            [&floatCalls](const std::vector<ConfigChange>&) { floatCalls++; });
+    configHandler.subscribeGroup("DEFAULT",
+                                 [&](const std::vector<ConfigChange> &changes)
+    {
+        groupCalls++;
+        groupChanges = changes;
+    });
+    TEST_NOT_EQUAL(intId, 0);
+
+    // reload without changes doesn't notify anyone
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(intCalls, 0);
+    TEST_EQUAL(groupCalls, 0);
+
+    // changes of one reload are delivered in one call
+    Kitsunemimi::writeFile(reloadFilePath,
+                           "[DEFAULT]\n"
+                           "string_val = poi\n"
+                           "int_val = 5\n"
+                           "float_val = 123.0\n"
+                           "string_list = a,b\n",
+                           error,
+                           true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(intCalls, 1);
+    TEST_EQUAL(floatCalls, 0);
+    TEST_EQUAL(groupCalls, 1);
+    TEST_EQUAL(groupChanges.size(), 3);
+    TEST_EQUAL(defaultCalls, 2);
+
+    // no notification after unsubscribe
+    TEST_EQUAL(configHandler.unsubscribe(intId), true);
+    TEST_EQUAL(configHandler.unsubscribe(intId), false);
+    Kitsunemimi::writeFile(reloadFilePath, getTestString(), error, true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(intCalls, 1);
+    TEST_EQUAL(groupCalls, 2);
+
+    // callbacks are called after the reload-lock is released, so they can ask for the sources
+    std::string origin = "";
+    ConfigHandler::ConfigSource source = ConfigHandler::UNDEFINED_SOURCE;
+    configHandler.subscribe("DEFAULT",
+                            "int_val",
+                            [&](const std::vector<ConfigChange>&)
+    {
+        source = configHandler.getValueSource("DEFAULT", "int_val", origin);
+    });
+    Kitsunemimi::writeFile(reloadFilePath, "[DEFAULT]\nint_val = 7\n", error, true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(source, ConfigHandler::FILE_SOURCE);
+    TEST_EQUAL(origin, reloadFilePath);
+
+    Kitsunemimi::deleteFileOrDir(reloadFilePath, error);
+}
+
+/**
+ * @brief configSources_test
+ */
+void
+ConfigHandler_Test::configSources_test()
+{
+    bool success = false;
+    ErrorContainer error;
+    std::string origin = "";
+    const std::string secondFilePath = "/tmp/ConfigHandler_Test_second.ini";
+    const std::string cacheFilePath = "/tmp/ConfigHandler_Test_sources.cache";
+    Kitsunemimi::writeFile(secondFilePath,
+                           "[DEFAULT]\n"
+                           "int_val = 3\n"
+                           "float_val = 5.0\n",
+                           error,
+                           true);
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+
+    // command-line arguments
+    ConfigSources sources;
+    const char* arguments[] = {"test", "-v", "--set", "DEFAULT.int_val=9", "--set=other.val=x"};
+    TEST_EQUAL(sources.addArguments(5, arguments, error), true);
+    TEST_EQUAL(sources.overrides.size(), 2);
+    TEST_EQUAL(sources.overrides[1].groupName, "other");
+    TEST_EQUAL(sources.overrides[1].itemName, "val");
+    TEST_EQUAL(sources.overrides[1].value, "x");
+    const char* brokenArguments[] = {"test", "--set", "int_val=9"};
+    ConfigSources brokenSources;
+    TEST_EQUAL(brokenSources.addArguments(3, brokenArguments, error), false);
+
+    // later files and overrides with higher precedence win, independent of the order of adding
+    sources.addFile(m_testFilePath);
+    sources.addFile(secondFilePath);
+    sources.addOverride(ConfigHandler::ENVIRONMENT_SOURCE, "DEFAULT", "int_val", "7", "INT_VAL");
+    sources.addOverride(ConfigHandler::ENVIRONMENT_SOURCE, "DEFAULT", "string_val", "env", "STR");
+
+    for(uint32_t i = 0; i < 2; i++)
+    {
+        ConfigHandler configHandler;
+        TEST_EQUAL(configHandler.initConfig(sources, error, cacheFilePath), true);
+
+        // second run uses the cache
+        const bool cacheUsed = configHandler.m_configCache != nullptr;
+        TEST_EQUAL(cacheUsed, i == 1);
+
+        ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+        ConfigKey<double> floatKey = configHandler.registerFloat("DEFAULT", "float_val", error);
+        configHandler.registerString("DEFAULT", "string_val", error);
+        configHandler.registerBoolean("DEFAULT", "bool_value", error);
+        configHandler.registerString("DEFAULT", "missing_val", error, "default");
+        configHandler.registerString("other", "val", error);
+        configHandler.sealConfig();
+        TEST_EQUAL(configHandler.isConfigValid(), true);
+
+        // values
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 9);
+        TEST_EQUAL(configHandler.getFloat(floatKey, success), 5.0);
+        TEST_EQUAL(configHandler.getString("DEFAULT", "string_val", success), "env");
+        TEST_EQUAL(configHandler.getString("other", "val", success), "x");
+
+        // sources of the values, also if they were taken from the cache
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "int_val", origin),
+                   ConfigHandler::COMMAND_LINE_SOURCE);
+        TEST_EQUAL(origin, "--set DEFAULT.int_val=9");
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "string_val", origin),
+                   ConfigHandler::ENVIRONMENT_SOURCE);
+        TEST_EQUAL(origin, "STR");
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "float_val", origin),
+                   ConfigHandler::FILE_SOURCE);
+        TEST_EQUAL(origin, secondFilePath);
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "bool_value", origin),
+                   ConfigHandler::FILE_SOURCE);
+        TEST_EQUAL(origin, m_testFilePath);
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "missing_val", origin),
+                   ConfigHandler::DEFAULT_SOURCE);
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "fail", origin),
+                   ConfigHandler::UNDEFINED_SOURCE);
+    }
+
+    // reload updates the sources of changed values
+    {
+        ConfigSources fileSources;
+        fileSources.addFile(m_testFilePath);
+        fileSources.addFile(secondFilePath);
+        ConfigHandler configHandler;
+        configHandler.initConfig(fileSources, error);
+        ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+        configHandler.sealConfig();
+
+        Kitsunemimi::writeFile(secondFilePath, "[DEFAULT]\nfloat_val = 5.0\n", error, true);
+        TEST_EQUAL(configHandler.reloadConfig(error), true);
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "int_val", origin),
+                   ConfigHandler::FILE_SOURCE);
+        TEST_EQUAL(origin, m_testFilePath);
+    }
+
+    // broken override
+    ConfigSources invalidSources;
+    invalidSources.addFile(m_testFilePath);
+    invalidSources.addOverride(ConfigHandler::ENVIRONMENT_SOURCE, "DEFAULT", "int_val", "1\n2");
+    ConfigHandler invalidHandler;
+    TEST_EQUAL(invalidHandler.initConfig(invalidSources, error), false);
+
+    Kitsunemimi::deleteFileOrDir(secondFilePath, error);
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+}
+
+/**
+ * @brief environment_test
+ */
+void
+ConfigHandler_Test::environment_test()
+{
+    bool success = false;
+    ErrorContainer error;
+    std::string origin = "";
+    const std::string cacheFilePath = "/tmp/ConfigHandler_Test_environment.cache";
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+
+    TEST_EQUAL(ConfigHandler::getEnvironmentName("KITSUNEMIMI", "my-group", "item.val"),
+               "KITSUNEMIMI_MY_GROUP_ITEM_VAL");
+
+    setenv("KITSUNEMIMI_DEFAULT_INT_VAL", "42", 1);
+    setenv("KITSUNEMIMI_DEFAULT_STRING_VAL", "env", 1);
+    setenv("KITSUNEMIMI_DEFAULT_FLOAT_VAL", "asdf", 1);
+    setenv("KITSUNEMIMI_OTHER_NEW_VAL", "7", 1);
+
+    ConfigSources sources;
+    sources.addFile(m_testFilePath);
+    sources.addEnvironment();
+    sources.addOverride(ConfigHandler::COMMAND_LINE_SOURCE, "DEFAULT", "string_val", "cli");
+
+    // environment is read once at the initialization
+    for(uint32_t i = 0; i < 2; i++)
+    {
+        ConfigHandler configHandler;
+        TEST_EQUAL(configHandler.initConfig(sources, error, cacheFilePath), true);
+        TEST_EQUAL(configHandler.m_environment.size(), 4);
+        setenv("KITSUNEMIMI_DEFAULT_BOOL_VALUE", "false", 1);
+
+        ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+        ConfigKey<std::string> stringKey =
+                configHandler.registerString("DEFAULT", "string_val", error);
+        configHandler.registerBoolean("DEFAULT", "bool_value", error);
+        ConfigKey<long> newKey = configHandler.registerInteger("other", "new_val", error, 1, true);
+        TEST_EQUAL(configHandler.isConfigValid(), true);
+        configHandler.sealConfig();
+        unsetenv("KITSUNEMIMI_DEFAULT_BOOL_VALUE");
+
+        // values of the environment, but the command-line has a higher precedence
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 42);
+        TEST_EQUAL(configHandler.getString(stringKey, success), "cli");
+        TEST_EQUAL(configHandler.getBoolean("DEFAULT", "bool_value", success), true);
+        TEST_EQUAL(configHandler.getInteger(newKey, success), 7);
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "int_val", origin),
+                   ConfigHandler::ENVIRONMENT_SOURCE);
+        TEST_EQUAL(origin, "KITSUNEMIMI_DEFAULT_INT_VAL");
+
+        // reload keeps the values of the environment
+        TEST_EQUAL(configHandler.reloadConfig(error), true);
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 42);
+    }
+
+    // values of the environment are checked like values of the config-file
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(sources, error);
+        TEST_EQUAL(configHandler.registerFloat("DEFAULT", "float_val", error).isValid(), false);
+        TEST_EQUAL(configHandler.isConfigValid(), false);
+    }
+
+    // environment is not used without prefix
+    {
+        ConfigSources fileSources;
+        fileSources.addFile(m_testFilePath);
+        ConfigHandler configHandler;
+        configHandler.initConfig(fileSources, error);
+        ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+    }
+
+    unsetenv("KITSUNEMIMI_DEFAULT_INT_VAL");
+    unsetenv("KITSUNEMIMI_DEFAULT_STRING_VAL");
+    unsetenv("KITSUNEMIMI_DEFAULT_FLOAT_VAL");
+    unsetenv("KITSUNEMIMI_OTHER_NEW_VAL");
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+}
+
+/**
+ * @brief includes_test
+ */
+void
+ConfigHandler_Test::includes_test()
+{
+    bool success = false;
+    ErrorContainer error;
+    std::string origin = "";
+    const std::string directory = "/tmp/ConfigHandler_Test_includes";
+    const std::string basePath = directory + "/base.ini";
+    Kitsunemimi::deleteFileOrDir(directory, error);
+    mkdir(directory.c_str(), 0700);
+    mkdir((directory + "/conf.d").c_str(), 0700);
+
+    Kitsunemimi::writeFile(basePath,
+                           "include = common.ini\n"
+                           "include_dir = conf.d/*.ini\n"
+                           "[DEFAULT]\n"
+                           "string_val = base\n"
+                           "int_val = 1\n",
+                           error,
+                           true);
+    Kitsunemimi::writeFile(directory + "/common.ini", "[DEFAULT]\nint_val = 2\n", error, true);
+    Kitsunemimi::writeFile(directory + "/conf.d/20-b.ini",
+                           "[DEFAULT]\nint_val = 4\n",
+                           error,
+                           true);
+    Kitsunemimi::writeFile(directory + "/conf.d/10-a.ini",
+                           "[DEFAULT]\nint_val = 3\nfloat_val = 1.5\n",
+                           error,
+                           true);
+    Kitsunemimi::writeFile(directory + "/conf.d/other.txt",
+                           "[DEFAULT]\nint_val = 5\n",
+                           error,
+                           true);
+
+    // files, which were changed within the last second, are always read again, so all files
+    // are made older for the check of the cached files
+    const struct timespec times[2] = {{time(nullptr) - 10, 0}, {time(nullptr) - 10, 0}};
+    const std::vector<std::string> fileNames = {"base.ini",
+                                                "common.ini",
+                                                "conf.d/10-a.ini",
+                                                "conf.d/20-b.ini"};
+    for(const std::string &fileName : fileNames) {
+        utimensat(AT_FDCWD, (directory + "/" + fileName).c_str(), times, 0);
+    }
+
+    ConfigHandler configHandler;
+    TEST_EQUAL(configHandler.initConfig(basePath, error), true);
+    ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+    ConfigKey<double> floatKey = configHandler.registerFloat("DEFAULT", "float_val", error);
+    ConfigKey<std::string> stringKey = configHandler.registerString("DEFAULT", "string_val", error);
+    configHandler.sealConfig();
+    TEST_EQUAL(configHandler.isConfigValid(), true);
+
+    // included files override the including file and are merged in the order of their names
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 4);
+    TEST_EQUAL(configHandler.getFloat(floatKey, success), 1.5);
+    TEST_EQUAL(configHandler.getString(stringKey, success), "base");
+    TEST_EQUAL(configHandler.getValueSource("DEFAULT", "int_val", origin),
+               ConfigHandler::FILE_SOURCE);
+    TEST_EQUAL(origin, directory + "/conf.d/20-b.ini");
+    TEST_EQUAL(configHandler.m_fragments.size(), 4);
+
+    // files of the same include-directory are not allowed to set the same item
+    std::vector<ConfigConflict> conflicts = configHandler.getConflicts();
+    TEST_EQUAL(conflicts.size(), 1);
+    if(conflicts.size() == 1)
+    {
+        TEST_EQUAL(conflicts[0].itemName, "int_val");
+        TEST_EQUAL(conflicts[0].origin, directory + "/conf.d/20-b.ini");
+        TEST_EQUAL(conflicts[0].overriddenOrigin, directory + "/conf.d/10-a.ini");
+    }
+
+    // unchanged files are not read again at a reload
+    const int64_t baseReadTime = configHandler.m_fragments[basePath].readTime;
+    Kitsunemimi::writeFile(directory + "/conf.d/20-b.ini",
+                           "[DEFAULT]\nstring_val = fragment\n",
+                           error,
+                           true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(configHandler.m_fragments[basePath].readTime, baseReadTime);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 3);
+    TEST_EQUAL(configHandler.getString(stringKey, success), "fragment");
+    TEST_EQUAL(configHandler.getConflicts().size(), 0);
+
+    // removed files are forgotten
+    Kitsunemimi::deleteFileOrDir(directory + "/conf.d/10-a.ini", error);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+    TEST_EQUAL(configHandler.getFloat(floatKey, success), 0.0);
+    TEST_EQUAL(configHandler.m_fragments.size(), 3);
+
+    // include-cycle
+    Kitsunemimi::writeFile(directory + "/common.ini", "include = base.ini\n", error, true);
+    TEST_EQUAL(configHandler.reloadConfig(error), false);
+    TEST_EQUAL(configHandler.getInteger(intKey, success), 2);
+
+    // missing include-directory
+    Kitsunemimi::writeFile(directory + "/common.ini", "include_dir = missing\n", error, true);
+    TEST_EQUAL(configHandler.reloadConfig(error), false);
+
+    Kitsunemimi::deleteFileOrDir(directory, error);
+}
+
+/**
+ * @brief parallelLoading_test
+ */
+void
+ConfigHandler_Test::parallelLoading_test()
+{
+    bool success = false;
+    ErrorContainer error;
+    std::string origin = "";
+    const std::string directory = "/tmp/ConfigHandler_Test_parallel";
+    Kitsunemimi::deleteFileOrDir(directory, error);
+    mkdir(directory.c_str(), 0700);
+
+    // every fragment overrides the same item, so the result depends on the order of merging
+    for(uint32_t i = 0; i < 50; i++)
+    {
+        const std::string number = std::to_string(100 + i);
+        Kitsunemimi::writeFile(directory + "/" + number + ".ini",
+                               "[DEFAULT]\n"
+                               "int_val = " + number + "\n"
+                               "\n"
+                               "[group_" + number + "]\n"
+                               "item = " + number + "\n",
+                               error,
+                               true);
+    }
+
+    for(const uint32_t numberOfThreads : {1u, 4u, 0u})
+    {
+        ConfigSources sources;
+        sources.addFile(m_testFilePath);
+        sources.addDirectory(directory);
+        sources.setNumberOfThreads(numberOfThreads);
+
+        ConfigHandler configHandler;
+        TEST_EQUAL(configHandler.initConfig(sources, error), true);
+        ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+        ConfigKey<long> itemKey = configHandler.registerInteger("group_120", "item", error);
+        configHandler.sealConfig();
+        TEST_EQUAL(configHandler.isConfigValid(), true);
+
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 149);
+        TEST_EQUAL(configHandler.getInteger(itemKey, success), 120);
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "int_val", origin),
+                   ConfigHandler::FILE_SOURCE);
+        TEST_EQUAL(origin, directory + "/149.ini");
+        TEST_EQUAL(configHandler.getConflicts().size(), 1);
+
+        // broken fragment is reported independent of the number of threads
+        Kitsunemimi::writeFile(directory + "/125.ini", "[DEFAULT\n", error, true);
+        TEST_EQUAL(configHandler.reloadConfig(error), false);
+        Kitsunemimi::writeFile(directory + "/125.ini", "[DEFAULT]\nint_val = 125\n", error, true);
+        TEST_EQUAL(configHandler.reloadConfig(error), true);
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 149);
+    }
+
+    // a file, which is listed multiple times, is read only once by the threads
+    {
+        const std::string repeatedFilePath = directory + "/repeated.conf";
+        std::string repeatedContent = "[DEFAULT]\nint_val = 7\n";
+        for(uint32_t i = 0; i < 1000; i++) {
+            const std::string number = std::to_string(i);
+            repeatedContent += "[group_" + number + "]\nitem = " + number + "\n";
+        }
+        Kitsunemimi::writeFile(repeatedFilePath, repeatedContent, error, true);
+
+        ConfigSources sources;
+        sources.addFile(m_testFilePath);
+        for(uint32_t i = 0; i < 8; i++) {
+            sources.addFile(repeatedFilePath);
+        }
+        sources.setNumberOfThreads(4);
+
+        ConfigHandler configHandler;
+        TEST_EQUAL(configHandler.initConfig(sources, error), true);
+        ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+        configHandler.sealConfig();
+        TEST_EQUAL(configHandler.getInteger(intKey, success), 7);
+        TEST_EQUAL(configHandler.getValueSource("DEFAULT", "int_val", origin),
+                   ConfigHandler::FILE_SOURCE);
+        TEST_EQUAL(origin, repeatedFilePath);
+    }
+
+    Kitsunemimi::deleteFileOrDir(directory, error);
 }
 
 /**
@@ -392,6 +1892,261 @@ ConfigHandler_Test::cleanupTestCase()
     Kitsunemimi::deleteFileOrDir(m_testFilePath, error);
 }
 
+/**
+ * @brief accessStats_test
+ */
+void
+ConfigHandler_Test::accessStats_test()
+{
+    bool success = false;
+    ErrorContainer error;
+
+    ConfigHandler configHandler;
+    configHandler.initConfig(m_testFilePath, error);
+    ConfigKey<long> intKey = configHandler.registerInteger("DEFAULT", "int_val", error);
+    ConfigKey<std::string> stringKey = configHandler.registerString("DEFAULT", "string_val", error);
+    configHandler.registerDuration("DEFAULT", "timeout", error, std::chrono::seconds(1));
+    configHandler.sealConfig();
+
+#ifdef KITSUNEMIMI_CONFIG_ACCESS_STATS
+    for(uint32_t i = 0; i < 10; i++) {
+        configHandler.getInteger(intKey, success);
+    }
+    for(uint32_t i = 0; i < 5; i++) {
+        configHandler.getInteger("DEFAULT", "int_val", success);
+    }
+    {
+        ConfigHandler::SnapshotReader reader(&configHandler);
+        for(uint32_t i = 0; i < 3; i++) {
+            reader.getStringView(stringKey, success);
+        }
+    }
+
+    // failed reads are not counted
+    configHandler.getInteger("DEFAULT", "string_val", success);
+    configHandler.getInteger(ConfigKey<long>(), success);
+
+    // each new thread samples exactly every n-th of its reads
+    const uint32_t readsPerThread = CONFIG_ACCESS_SAMPLE_RATE * 100;
+    std::vector<std::thread> threads;
+    for(uint32_t t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&configHandler, readsPerThread]() {
+            bool threadSuccess = false;
+            for(uint32_t i = 0; i < readsPerThread; i++) {
+                configHandler.getDuration("DEFAULT", "timeout", threadSuccess);
+            }
+        });
+    }
+    for(std::thread &thread : threads) {
+        thread.join();
+    }
+
+    const std::vector<ConfigAccessStats> stats = configHandler.getConfigAccessStats();
+    TEST_EQUAL(stats.size(), 3);
+    TEST_EQUAL(stats[0].itemName, "int_val");
+    TEST_EQUAL(stats[0].type, ConfigHandler::INT_TYPE);
+    TEST_EQUAL(stats[0].numberOfReads, 15);
+    TEST_EQUAL(stats[1].itemName, "string_val");
+    TEST_EQUAL(stats[1].numberOfReads, 3);
+    TEST_EQUAL(stats[2].itemName, "timeout");
+    TEST_EQUAL(stats[2].numberOfReads, 4 * readsPerThread);
+    TEST_EQUAL(stats[2].numberOfSamples, 400);
+    TEST_EQUAL(stats[2].latencyHistogram.size(), CONFIG_LATENCY_BUCKETS);
+#else
+    configHandler.getInteger(intKey, success);
+    configHandler.getString(stringKey, success);
+    TEST_EQUAL(configHandler.getConfigAccessStats().size(), 0);
+#endif
+}
+
+/**
+ * @brief loadProfile_test
+ */
+void
+ConfigHandler_Test::loadProfile_test()
+{
+    ErrorContainer error;
+    const std::string cacheFilePath = "/tmp/ConfigHandler_Test_profile.cache";
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+
+    // initialization without cache
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(m_testFilePath, error, cacheFilePath);
+
+        ConfigLoadProfile profile = configHandler.getLoadProfile();
+        TEST_EQUAL(profile.numberOfSources, 1);
+        TEST_EQUAL(profile.bytesRead, getTestString().size());
+        TEST_EQUAL(profile.cacheHit, false);
+        TEST_EQUAL(profile.numberOfRegistrations, 0);
+        const std::chrono::nanoseconds initPhases = profile.readTime
+                                                    + profile.parseTime
+                                                    + profile.cacheTime;
+        const bool phasesInInit = profile.initTime >= initPhases;
+        TEST_EQUAL(phasesInInit, true);
+        TEST_NOT_EQUAL(profile.parseTime.count(), 0);
+
+        // successful, wrong typed and duplicate registrations
+        configHandler.registerInteger("DEFAULT", "int_val", error);
+        configHandler.registerString("DEFAULT", "string_val", error);
+        configHandler.registerInteger("DEFAULT", "float_val", error);
+        configHandler.registerInteger("DEFAULT", "int_val", error);
+        const std::vector<ConfigSpec> schema = {
+            ConfigSpec::forBoolean("DEFAULT", "bool_value"),
+            ConfigSpec::forInteger("DEFAULT", "string_list")
+        };
+        configHandler.registerSchema(schema, error);
+
+        profile = configHandler.getLoadProfile();
+        TEST_EQUAL(profile.numberOfRegistrations, 6);
+        TEST_EQUAL(profile.numberOfRegistrationErrors, 3);
+        TEST_NOT_EQUAL(profile.errorFormattingTime.count(), 0);
+        const std::chrono::nanoseconds registrationPhases = profile.checkTypeTime
+                                                            + profile.registerTypeTime
+                                                            + profile.errorFormattingTime;
+        const bool phasesInRegistration = profile.registrationTime >= registrationPhases;
+        TEST_EQUAL(phasesInRegistration, true);
+        TEST_EQUAL(profile.sealTime.count(), 0);
+
+        // the invalid config writes no cache, so only valid items are registered again
+        ConfigHandler validHandler;
+        validHandler.initConfig(m_testFilePath, error, cacheFilePath);
+        validHandler.registerInteger("DEFAULT", "int_val", error);
+        validHandler.sealConfig();
+        TEST_NOT_EQUAL(validHandler.getLoadProfile().sealTime.count(), 0);
+
+        // reloads are not part of the profile
+        const ConfigLoadProfile sealedProfile = validHandler.getLoadProfile();
+        validHandler.reloadConfig(error);
+        TEST_EQUAL(validHandler.getLoadProfile().readTime.count(), sealedProfile.readTime.count());
+        TEST_EQUAL(validHandler.getLoadProfile().bytesRead, sealedProfile.bytesRead);
+    }
+
+    // initialization with cache doesn't parse the config-file
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(m_testFilePath, error, cacheFilePath);
+        configHandler.registerInteger("DEFAULT", "int_val", error);
+
+        const ConfigLoadProfile profile = configHandler.getLoadProfile();
+        TEST_EQUAL(profile.cacheHit, true);
+        TEST_EQUAL(profile.parseTime.count(), 0);
+        TEST_NOT_EQUAL(profile.cacheTime.count(), 0);
+        TEST_EQUAL(profile.numberOfRegistrations, 1);
+        TEST_EQUAL(profile.numberOfRegistrationErrors, 0);
+        TEST_EQUAL(profile.checkTypeTime.count(), 0);
+    }
+
+    // global config is not initialized
+    TEST_EQUAL(getLoadProfile().numberOfSources, 0);
+
+    Kitsunemimi::deleteFileOrDir(cacheFilePath, error);
+}
+
+/**
+ * @brief memoryUsage_test
+ */
+void
+ConfigHandler_Test::memoryUsage_test()
+{
+    ErrorContainer error;
+
+    // the report has to explain at least 90 percent of the allocated memory. The rest are small
+    // parts like the list of config-files, which are not part of the report.
+    auto isClose = [](const uint64_t reported, const uint64_t allocated) {
+        return reported <= allocated && reported * 10 >= allocated * 9;
+    };
+
+    // the counters of the instrumented getter are not part of the report
+#ifdef KITSUNEMIMI_CONFIG_ACCESS_STATS
+    const bool instrumented = true;
+#else
+    const bool instrumented = false;
+#endif
+
+    const int64_t allocatedBefore = getAllocatedBytes();
+    {
+        ConfigHandler configHandler;
+        configHandler.initConfig(m_testFilePath, error);
+        for(uint32_t i = 0; i < 200; i++)
+        {
+            const std::string suffix = "_with_a_long_name_" + std::to_string(i);
+            configHandler.registerString("group", "string" + suffix, error, "default" + suffix);
+            configHandler.registerInteger("group", "int" + suffix, error, i);
+            configHandler.registerStringArray("group", "array" + suffix, error, {"a", "b"});
+        }
+        configHandler.registerString("DEFAULT", "string_val", error);
+
+        ConfigMemoryUsage usage = configHandler.getMemoryUsage();
+        TEST_NOT_EQUAL(usage.parsedTree, 0);
+        TEST_NOT_EQUAL(usage.registry, 0);
+        TEST_NOT_EQUAL(usage.values, 0);
+        TEST_NOT_EQUAL(usage.stringPayloads, 0);
+        TEST_NOT_EQUAL(usage.defaults, 0);
+        TEST_NOT_EQUAL(usage.sources, 0);
+        TEST_NOT_EQUAL(usage.origins, 0);
+        TEST_EQUAL(usage.total, usage.parsedTree
+                                + usage.registry
+                                + usage.values
+                                + usage.stringPayloads
+                                + usage.defaults
+                                + usage.sources
+                                + usage.origins);
+
+        // the parsed config-file is deleted by the seal
+        configHandler.sealConfig();
+        usage = configHandler.getMemoryUsage();
+        TEST_EQUAL(usage.parsedTree, 0);
+
+        const uint64_t allocated = getAllocatedBytes() - allocatedBefore;
+        const bool explained = instrumented || isClose(usage.total, allocated);
+        TEST_EQUAL(explained, true);
+    }
+
+    // parsed values with long strings
+    {
+        const std::string filePath = "/tmp/ConfigHandler_Test_memory.ini";
+        std::string content = "[group]\n";
+        for(uint32_t i = 0; i < 100; i++)
+        {
+            content += "item_with_a_long_name_" + std::to_string(i)
+                       + " = value_with_a_long_content_" + std::to_string(i) + "\n";
+        }
+        Kitsunemimi::writeFile(filePath, content, error, true);
+
+        const int64_t parsedBefore = getAllocatedBytes();
+        ConfigHandler configHandler;
+        configHandler.initConfig(filePath, error);
+        const ConfigMemoryUsage usage = configHandler.getMemoryUsage();
+        const bool treeLargerThanContent = usage.parsedTree > content.size();
+        TEST_EQUAL(treeLargerThanContent, true);
+        const uint64_t allocated = getAllocatedBytes() - parsedBefore;
+        const bool explained = instrumented || isClose(usage.total, allocated);
+        TEST_EQUAL(explained, true);
+
+        Kitsunemimi::deleteFileOrDir(filePath, error);
+    }
+
+    // overlays don't count the registered items of their base
+    {
+        ConfigHandler baseHandler;
+        baseHandler.initConfig(m_testFilePath, error);
+        baseHandler.registerString("DEFAULT", "string_val", error);
+        baseHandler.sealConfig();
+
+        ConfigHandler overlayHandler;
+        overlayHandler.initOverlay(baseHandler, m_testFilePath, error);
+        const ConfigMemoryUsage usage = overlayHandler.getMemoryUsage();
+        TEST_EQUAL(usage.registry, 0);
+        TEST_EQUAL(usage.defaults, 0);
+        TEST_NOT_EQUAL(usage.values, 0);
+    }
+
+    // global config is not initialized
+    TEST_EQUAL(getMemoryUsage().total, 0);
+}
+
 /**
  * @brief ConfigHandler_Test::getTestString
  * @return
@@ -24,12 +24,17 @@ private:
     void initTestCase();
 
     void readConfig_test();
+    void readConfigFile_test();
 
     // private methods
     void registerType_test();
     void isRegistered_test();
     void getRegisteredType_test();
     void checkType_test();
+    void hashGroups_test();
+    void extractIncludes_test();
+    void parseDuration_test();
+    void parseByteSize_test();
 
     // public methods
     void registerString_test();
@@ -37,11 +42,30 @@ private:
     void registerFloat_test();
     void registerBoolean_test();
     void registerStringArray_test();
+    void registerDuration_test();
+    void registerByteSize_test();
+    void registerSchema_test();
     void getString_test();
     void getInteger_test();
     void getFloat_test();
     void getBoolean_test();
     void getStringArray_test();
+    void getStringView_test();
+    void getStringArrayView_test();
+    void sealConfig_test();
+    void freezeConfig_test();
+    void reloadConfig_test();
+    void incrementalReload_test();
+    void initOverlay_test();
+    void configCache_test();
+    void subscribe_test();
+    void configSources_test();
+    void environment_test();
+    void includes_test();
+    void parallelLoading_test();
+    void accessStats_test();
+    void loadProfile_test();
+    void memoryUsage_test();
 
     void cleanupTestCase();
 
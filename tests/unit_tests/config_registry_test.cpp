@@ -0,0 +1,184 @@
+/**
+ *  @file       config_registry_test.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include "config_registry_test.h"
+
+#include <config_registry.h>
+#include <counting_allocator.h>
+
+namespace Kitsunemimi
+{
+
+ConfigRegistry_Test::ConfigRegistry_Test()
+    : Kitsunemimi::CompareTestHelper("ConfigRegistry_Test")
+{
+    insert_test();
+    find_test();
+    rehash_test();
+    reserve_test();
+    getMemoryUsage_test();
+    nameIds_test();
+}
+
+/**
+ * @brief insert_test
+ */
+void
+ConfigRegistry_Test::insert_test()
+{
+    ConfigRegistry<int> registry;
+
+    TEST_EQUAL(registry.insert("group", "item", 1), true);
+    TEST_EQUAL(registry.insert("group", "item2", 2), true);
+    TEST_EQUAL(registry.insert("group2", "item", 3), true);
+    TEST_EQUAL(registry.insert("group", "item", 4), false);
+    TEST_EQUAL(registry.size(), 3);
+
+    // iteration in order of the registration
+    std::string itemNames = "";
+    for(const ConfigRegistry<int>::Item &item : registry) {
+        itemNames += registry.getName(item.groupId) + "." + registry.getName(item.itemId) + ";";
+    }
+    TEST_EQUAL(itemNames, "group.item;group.item2;group2.item;");
+}
+
+/**
+ * @brief find_test
+ */
+void
+ConfigRegistry_Test::find_test()
+{
+    ConfigRegistry<int> registry;
+    registry.insert("group", "item", 1);
+
+    TEST_NOT_EQUAL(registry.find("group", "item"), nullptr);
+    TEST_EQUAL(*registry.find("group", "item"), 1);
+    TEST_EQUAL(*registry.find(std::string("group"), std::string_view("item")), 1);
+    TEST_EQUAL(registry.find("group", "item2"), nullptr);
+    TEST_EQUAL(registry.find("groupitem", ""), nullptr);
+    TEST_EQUAL(registry.find("", "groupitem"), nullptr);
+    TEST_EQUAL(registry.find("item", "group"), nullptr);
+}
+
+/**
+ * @brief rehash_test
+ */
+void
+ConfigRegistry_Test::rehash_test()
+{
+    ConfigRegistry<int> registry;
+    for(int i = 0; i < 5000; i++) {
+        registry.insert("group" + std::to_string(i % 10), "item" + std::to_string(i), i);
+    }
+    TEST_EQUAL(registry.size(), 5000);
+
+    bool allFound = true;
+    for(int i = 0; i < 5000; i++)
+    {
+        const int* value = registry.find("group" + std::to_string(i % 10),
+                                         "item" + std::to_string(i));
+        if(value == nullptr
+                || *value != i)
+        {
+            allFound = false;
+        }
+    }
+    TEST_EQUAL(allFound, true);
+    TEST_EQUAL(registry.find("group1", "item0"), nullptr);
+}
+
+/**
+ * @brief reserve_test
+ */
+void
+ConfigRegistry_Test::reserve_test()
+{
+    ConfigRegistry<int> registry;
+    registry.insert("group", "item", 1);
+    registry.reserve(1000);
+
+    TEST_EQUAL(registry.size(), 1);
+    TEST_EQUAL(*registry.find("group", "item"), 1);
+    TEST_EQUAL(registry.insert("group", "item2", 2), true);
+    TEST_EQUAL(*registry.find("group", "item2"), 2);
+}
+
+/**
+ * @brief getMemoryUsage_test
+ */
+void
+ConfigRegistry_Test::getMemoryUsage_test()
+{
+    const int64_t allocatedBefore = getAllocatedBytes();
+    ConfigRegistry<int> registry;
+    uint64_t allocated = getAllocatedBytes() - allocatedBefore;
+    TEST_EQUAL(registry.getMemoryUsage(), allocated);
+
+    // short names are stored within the string-object, long ones have their own buffer
+    for(int i = 0; i < 1000; i++)
+    {
+        registry.insert("group" + std::to_string(i % 10),
+                        "item_with_a_name_longer_than_the_inline_buffer_" + std::to_string(i),
+                        i);
+    }
+
+    allocated = getAllocatedBytes() - allocatedBefore;
+    TEST_EQUAL(registry.getMemoryUsage(), allocated);
+}
+
+/**
+ * @brief nameIds_test
+ */
+void
+ConfigRegistry_Test::nameIds_test()
+{
+    ConfigRegistry<int> registry;
+    registry.insert("DEFAULT", "item", 1);
+    registry.insert("DEFAULT", "item2", 2);
+    registry.insert("group", "item", 3);
+    registry.insert("item", "DEFAULT", 4);
+
+    // names are shared by all items and between group- and item-names
+    TEST_EQUAL(registry.numberOfNames(), 4);
+
+    const uint32_t defaultId = registry.getNameId("DEFAULT");
+    const uint32_t itemId = registry.getNameId("item");
+    TEST_NOT_EQUAL(defaultId, UNKNOWN_CONFIG_NAME);
+    TEST_NOT_EQUAL(itemId, UNKNOWN_CONFIG_NAME);
+    TEST_EQUAL(registry.getNameId(std::string("DEFAULT")), defaultId);
+    TEST_EQUAL(registry.getNameId("unknown"), UNKNOWN_CONFIG_NAME);
+    TEST_EQUAL(registry.getName(defaultId), "DEFAULT");
+    TEST_EQUAL(registry.getName(itemId), "item");
+
+    // lookup by ids
+    TEST_EQUAL(*registry.find(defaultId, itemId), 1);
+    TEST_EQUAL(*registry.find(itemId, defaultId), 4);
+    TEST_EQUAL(registry.find(defaultId, defaultId), nullptr);
+
+    // iterated items refer to their names by id
+    bool idsMatch = true;
+    for(const ConfigRegistry<int>::Item &item : registry)
+    {
+        if(registry.find(registry.getName(item.groupId), registry.getName(item.itemId))
+                != &item.value)
+        {
+            idsMatch = false;
+        }
+    }
+    TEST_EQUAL(idsMatch, true);
+
+    // ids are stable, while new names are added
+    for(int i = 0; i < 1000; i++) {
+        registry.insert("group" + std::to_string(i), "item", i);
+    }
+    TEST_EQUAL(registry.getNameId("DEFAULT"), defaultId);
+    TEST_EQUAL(registry.getName(itemId), "item");
+    TEST_EQUAL(registry.numberOfNames(), 1004);
+}
+
+} // namespace Kitsunemimi
@@ -0,0 +1,34 @@
+/**
+ *  @file       config_registry_test.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_REGISTRY_TEST_H
+#define CONFIG_REGISTRY_TEST_H
+
+#include <libKitsunemimiCommon/test_helper/compare_test_helper.h>
+
+namespace Kitsunemimi
+{
+
+class ConfigRegistry_Test
+        : public Kitsunemimi::CompareTestHelper
+{
+public:
+    ConfigRegistry_Test();
+
+private:
+    void insert_test();
+    void find_test();
+    void rehash_test();
+    void reserve_test();
+    void getMemoryUsage_test();
+    void nameIds_test();
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_REGISTRY_TEST_H
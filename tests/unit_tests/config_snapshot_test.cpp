@@ -0,0 +1,282 @@
+/**
+ *  @file       config_snapshot_test.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include "config_snapshot_test.h"
+
+#include <config_snapshot.h>
+#include <counting_allocator.h>
+
+namespace Kitsunemimi
+{
+
+ConfigSnapshot_Test::ConfigSnapshot_Test()
+    : Kitsunemimi::CompareTestHelper("ConfigSnapshot_Test")
+{
+    appendString_test();
+    appendInteger_test();
+    appendFloat_test();
+    appendBoolean_test();
+    appendStringArray_test();
+    compact_test();
+    serialize_test();
+    layer_test();
+    getMemoryUsage_test();
+}
+
+/**
+ * @brief appendString_test
+ */
+void
+ConfigSnapshot_Test::appendString_test()
+{
+    ConfigSnapshot snapshot;
+
+    TEST_EQUAL(snapshot.appendString("asdf"), 0);
+    TEST_EQUAL(snapshot.appendString(""), 1);
+    TEST_EQUAL(snapshot.appendString("poi"), 2);
+    TEST_EQUAL(snapshot.numberOfStrings(), 3);
+
+    TEST_EQUAL(snapshot.getString(0), "asdf");
+    TEST_EQUAL(snapshot.getString(1), "");
+    TEST_EQUAL(snapshot.getString(2), "poi");
+    TEST_EQUAL(snapshot.getStringView(0), "asdf");
+    TEST_EQUAL(snapshot.getStringView(1), "");
+}
+
+/**
+ * @brief appendInteger_test
+ */
+void
+ConfigSnapshot_Test::appendInteger_test()
+{
+    ConfigSnapshot snapshot;
+
+    TEST_EQUAL(snapshot.appendInteger(42), 0);
+    TEST_EQUAL(snapshot.appendInteger(-1), 1);
+    TEST_EQUAL(snapshot.numberOfIntegers(), 2);
+
+    TEST_EQUAL(snapshot.getInteger(0), 42);
+    TEST_EQUAL(snapshot.getInteger(1), -1);
+}
+
+/**
+ * @brief appendFloat_test
+ */
+void
+ConfigSnapshot_Test::appendFloat_test()
+{
+    ConfigSnapshot snapshot;
+
+    TEST_EQUAL(snapshot.appendFloat(42.5), 0);
+    TEST_EQUAL(snapshot.numberOfFloats(), 1);
+
+    TEST_EQUAL(snapshot.getFloat(0), 42.5);
+}
+
+/**
+ * @brief appendBoolean_test
+ */
+void
+ConfigSnapshot_Test::appendBoolean_test()
+{
+    ConfigSnapshot snapshot;
+
+    // fill more than one word of the bitmap
+    for(uint32_t i = 0; i < 100; i++) {
+        snapshot.appendBoolean(i % 3 == 0);
+    }
+    TEST_EQUAL(snapshot.numberOfBooleans(), 100);
+
+    TEST_EQUAL(snapshot.getBoolean(0), true);
+    TEST_EQUAL(snapshot.getBoolean(1), false);
+    TEST_EQUAL(snapshot.getBoolean(63), true);
+    TEST_EQUAL(snapshot.getBoolean(64), false);
+    TEST_EQUAL(snapshot.getBoolean(99), true);
+}
+
+/**
+ * @brief appendStringArray_test
+ */
+void
+ConfigSnapshot_Test::appendStringArray_test()
+{
+    ConfigSnapshot snapshot;
+
+    TEST_EQUAL(snapshot.appendStringArray({"a", "bc", "def"}), 0);
+    TEST_EQUAL(snapshot.appendString("xyz"), 0);
+    TEST_EQUAL(snapshot.appendStringArray({}), 1);
+    TEST_EQUAL(snapshot.appendStringArray({"g"}), 2);
+    TEST_EQUAL(snapshot.numberOfStringArrays(), 3);
+
+    std::vector<std::string> result = snapshot.getStringArray(0);
+    TEST_EQUAL(result.size(), 3);
+    TEST_EQUAL(result.at(1), "bc");
+    TEST_EQUAL(result.at(2), "def");
+    TEST_EQUAL(snapshot.getStringArray(1).size(), 0);
+    TEST_EQUAL(snapshot.getStringArray(2).at(0), "g");
+    TEST_EQUAL(snapshot.getString(0), "xyz");
+
+    StringArrayView view = snapshot.getStringArrayView(0);
+    TEST_EQUAL(view.size(), 3);
+    TEST_EQUAL(view[1], "bc");
+    TEST_EQUAL(snapshot.getStringArrayView(1).empty(), true);
+    TEST_EQUAL(snapshot.getStringArrayView(2)[0], "g");
+}
+
+/**
+ * @brief compact_test
+ */
+void
+ConfigSnapshot_Test::compact_test()
+{
+    ConfigSnapshot snapshot;
+
+    snapshot.appendString("asdf");
+    snapshot.appendInteger(42);
+    snapshot.appendBoolean(true);
+    snapshot.appendStringArray({"a", "b"});
+    snapshot.compact();
+
+    TEST_EQUAL(snapshot.getString(0), "asdf");
+    TEST_EQUAL(snapshot.getInteger(0), 42);
+    TEST_EQUAL(snapshot.getBoolean(0), true);
+    TEST_EQUAL(snapshot.getStringArray(0).size(), 2);
+}
+
+/**
+ * @brief serialize_test
+ */
+void
+ConfigSnapshot_Test::serialize_test()
+{
+    ConfigSnapshot snapshot;
+    snapshot.appendString("asdf");
+    snapshot.appendInteger(42);
+    snapshot.appendFloat(13.5);
+    snapshot.appendBoolean(true);
+    snapshot.appendBoolean(false);
+    snapshot.appendStringArray({"a", "bc"});
+    snapshot.appendStringArray({});
+
+    std::string buffer = "header";
+    snapshot.serialize(buffer);
+
+    // restore behind other data
+    ConfigSnapshot restored;
+    uint64_t position = 6;
+    TEST_EQUAL(restored.deserialize(buffer, position), true);
+    TEST_EQUAL(position, buffer.size());
+    TEST_EQUAL(restored.getString(0), "asdf");
+    TEST_EQUAL(restored.getInteger(0), 42);
+    TEST_EQUAL(restored.getFloat(0), 13.5);
+    TEST_EQUAL(restored.numberOfBooleans(), 2);
+    TEST_EQUAL(restored.getBoolean(0), true);
+    TEST_EQUAL(restored.getBoolean(1), false);
+    TEST_EQUAL(restored.numberOfStringArrays(), 2);
+    TEST_EQUAL(restored.getStringArrayView(0)[1], "bc");
+    TEST_EQUAL(restored.getStringArray(1).size(), 0);
+
+    // truncated buffer
+    ConfigSnapshot truncated;
+    position = 6;
+    TEST_EQUAL(truncated.deserialize(buffer.substr(0, buffer.size() - 1), position), false);
+}
+
+/**
+ * @brief layer_test
+ */
+void
+ConfigSnapshot_Test::layer_test()
+{
+    ConfigSnapshot base;
+    base.appendString("asdf");
+    base.appendString("poi");
+    base.appendInteger(1);
+    base.appendInteger(2);
+    base.appendInteger(3);
+    base.appendFloat(1.5);
+    base.appendBoolean(false);
+    base.appendBoolean(true);
+    base.appendStringArray({"a", "b"});
+
+    ConfigSnapshot layer;
+    layer.setBase(&base);
+    layer.addOverride(ConfigHandler::STRING_TYPE, 1);
+    layer.appendString("xyz");
+    layer.addOverride(ConfigHandler::INT_TYPE, 0);
+    layer.appendInteger(10);
+    layer.addOverride(ConfigHandler::INT_TYPE, 2);
+    layer.appendInteger(30);
+    layer.addOverride(ConfigHandler::BOOL_TYPE, 0);
+    layer.appendBoolean(true);
+    layer.addOverride(ConfigHandler::STRING_ARRAY_TYPE, 0);
+    layer.appendStringArray({"c"});
+    layer.compact();
+
+    // number of values comes from the base
+    TEST_EQUAL(layer.numberOfStrings(), 2);
+    TEST_EQUAL(layer.numberOfIntegers(), 3);
+    TEST_EQUAL(layer.numberOfStringArrays(), 1);
+
+    // overridden values
+    TEST_EQUAL(layer.getString(1), "xyz");
+    TEST_EQUAL(layer.getStringView(1), "xyz");
+    TEST_EQUAL(layer.getInteger(0), 10);
+    TEST_EQUAL(layer.getInteger(2), 30);
+    TEST_EQUAL(layer.getBoolean(0), true);
+    TEST_EQUAL(layer.getStringArray(0).size(), 1);
+    TEST_EQUAL(layer.getStringArrayView(0)[0], "c");
+
+    // values of the base
+    TEST_EQUAL(layer.getString(0), "asdf");
+    TEST_EQUAL(layer.getInteger(1), 2);
+    TEST_EQUAL(layer.getFloat(0), 1.5);
+    TEST_EQUAL(layer.getBoolean(1), true);
+    TEST_EQUAL(base.getInteger(0), 1);
+}
+
+/**
+ * @brief getMemoryUsage_test
+ */
+void
+ConfigSnapshot_Test::getMemoryUsage_test()
+{
+    const int64_t allocatedBefore = getAllocatedBytes();
+    ConfigSnapshot snapshot;
+    for(uint32_t i = 0; i < 100; i++)
+    {
+        snapshot.appendString("string-value " + std::to_string(i));
+        snapshot.appendInteger(i);
+        snapshot.appendFloat(i * 0.5);
+        snapshot.appendBoolean(i % 2 == 0);
+        snapshot.appendStringArray({"a", "b", std::to_string(i)});
+    }
+
+    uint64_t allocated = getAllocatedBytes() - allocatedBefore;
+    TEST_EQUAL(snapshot.getMemoryUsage(), allocated);
+    const bool payloadIncluded = snapshot.getPayloadSize() > 0
+                                 && snapshot.getPayloadSize() < snapshot.getMemoryUsage();
+    TEST_EQUAL(payloadIncluded, true);
+
+    snapshot.compact();
+    allocated = getAllocatedBytes() - allocatedBefore;
+    TEST_EQUAL(snapshot.getMemoryUsage(), allocated);
+
+    // a layer counts only its own values
+    const int64_t layerBefore = getAllocatedBytes();
+    ConfigSnapshot layer;
+    layer.setBase(&snapshot);
+    layer.appendInteger(42);
+    layer.addOverride(ConfigHandler::INT_TYPE, 3);
+    allocated = getAllocatedBytes() - layerBefore;
+    TEST_EQUAL(layer.getMemoryUsage(), allocated);
+    const bool smallerThanBase = layer.getMemoryUsage() < snapshot.getMemoryUsage();
+    TEST_EQUAL(smallerThanBase, true);
+}
+
+} // namespace Kitsunemimi
@@ -0,0 +1,37 @@
+/**
+ *  @file       config_snapshot_test.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef CONFIG_SNAPSHOT_TEST_H
+#define CONFIG_SNAPSHOT_TEST_H
+
+#include <libKitsunemimiCommon/test_helper/compare_test_helper.h>
+
+namespace Kitsunemimi
+{
+
+class ConfigSnapshot_Test
+        : public Kitsunemimi::CompareTestHelper
+{
+public:
+    ConfigSnapshot_Test();
+
+private:
+    void appendString_test();
+    void appendInteger_test();
+    void appendFloat_test();
+    void appendBoolean_test();
+    void appendStringArray_test();
+    void compact_test();
+    void serialize_test();
+    void layer_test();
+    void getMemoryUsage_test();
+};
+
+} // namespace Kitsunemimi
+
+#endif // CONFIG_SNAPSHOT_TEST_H
@@ -0,0 +1,185 @@
+/**
+ *  @file       counting_allocator.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include "counting_allocator.h"
+
+#include <atomic>
+#include <new>
+#include <cstdlib>
+#include <cstddef>
+
+// the size of each allocation is stored in front of the returned memory
+#define ALLOCATION_HEADER_SIZE alignof(std::max_align_t)
+
+static std::atomic<int64_t> allocatedBytes {0};
+
+/**
+ * @brief allocate memory with a header for the size of the allocation
+ *
+ * @param size requested number of bytes
+ * @param alignment alignment of the returned memory, which is at least the size of the header
+ *
+ * @return pointer to the memory, or nullptr, if the allocation failed
+ */
+static void*
+allocateCounted(const std::size_t size, const std::size_t alignment)
+{
+    // aligned_alloc requires a size, which is a multiple of the alignment
+    const std::size_t blockSize = ((size + alignment + alignment - 1) / alignment) * alignment;
+    char* block = static_cast<char*>(std::aligned_alloc(alignment, blockSize));
+    if(block == nullptr) {
+        return nullptr;
+    }
+
+    char* memory = block + alignment;
+    *reinterpret_cast<std::size_t*>(memory - sizeof(std::size_t)) = size;
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    return memory;
+}
+
+/**
+ * @brief free memory, which was allocated by allocateCounted
+ *
+ * @param memory pointer to the memory
+ * @param alignment alignment, which was used for the allocation
+ */
+static void
+freeCounted(void* memory, const std::size_t alignment)
+{
+    if(memory == nullptr) {
+        return;
+    }
+
+    char* data = static_cast<char*>(memory);
+    const std::size_t size = *reinterpret_cast<std::size_t*>(data - sizeof(std::size_t));
+    allocatedBytes.fetch_sub(size, std::memory_order_relaxed);
+    std::free(data - alignment);
+}
+
+/**
+ * @brief get the alignment, which is used for an allocation
+ */
+static std::size_t
+getAlignment(const std::align_val_t alignment)
+{
+    const std::size_t value = static_cast<std::size_t>(alignment);
+    return value > ALLOCATION_HEADER_SIZE ? value : ALLOCATION_HEADER_SIZE;
+}
+
+//==================================================================================================
+
+void*
+operator new(std::size_t size)
+{
+    void* memory = allocateCounted(size, ALLOCATION_HEADER_SIZE);
+    if(memory == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void*
+operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void*
+operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return allocateCounted(size, ALLOCATION_HEADER_SIZE);
+}
+
+void*
+operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return allocateCounted(size, ALLOCATION_HEADER_SIZE);
+}
+
+void*
+operator new(std::size_t size, std::align_val_t alignment)
+{
+    void* memory = allocateCounted(size, getAlignment(alignment));
+    if(memory == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void*
+operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void
+operator delete(void* memory) noexcept
+{
+    freeCounted(memory, ALLOCATION_HEADER_SIZE);
+}
+
+void
+operator delete[](void* memory) noexcept
+{
+    freeCounted(memory, ALLOCATION_HEADER_SIZE);
+}
+
+void
+operator delete(void* memory, std::size_t) noexcept
+{
+    freeCounted(memory, ALLOCATION_HEADER_SIZE);
+}
+
+void
+operator delete[](void* memory, std::size_t) noexcept
+{
+    freeCounted(memory, ALLOCATION_HEADER_SIZE);
+}
+
+void
+operator delete(void* memory, std::align_val_t alignment) noexcept
+{
+    freeCounted(memory, getAlignment(alignment));
+}
+
+void
+operator delete[](void* memory, std::align_val_t alignment) noexcept
+{
+    freeCounted(memory, getAlignment(alignment));
+}
+
+void
+operator delete(void* memory, std::size_t, std::align_val_t alignment) noexcept
+{
+    freeCounted(memory, getAlignment(alignment));
+}
+
+void
+operator delete[](void* memory, std::size_t, std::align_val_t alignment) noexcept
+{
+    freeCounted(memory, getAlignment(alignment));
+}
+
+//==================================================================================================
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief get the number of bytes, which are currently allocated with the operator new
+ */
+int64_t
+getAllocatedBytes()
+{
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+} // namespace Kitsunemimi
@@ -0,0 +1,29 @@
+/**
+ *  @file       counting_allocator.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef COUNTING_ALLOCATOR_H
+#define COUNTING_ALLOCATOR_H
+
+#include <stdint.h>
+
+namespace Kitsunemimi
+{
+
+/**
+ * @brief get the number of bytes, which are currently allocated with the operator new within the
+ *        unit-tests. The global operator new and delete of the test-binary are replaced by
+ *        versions, which count the size of each allocation, so the memory-usage reported by the
+ *        config can be compared with the really allocated memory.
+ *
+ * @return number of allocated bytes without the bytes of the allocator itself
+ */
+int64_t getAllocatedBytes();
+
+} // namespace Kitsunemimi
+
+#endif // COUNTING_ALLOCATOR_H
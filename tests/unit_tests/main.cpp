@@ -7,10 +7,20 @@
  */
 
 #include <iostream>
+#include <config_binding_test.h>
+#include <config_cache_test.h>
 #include <config_handler_test.h>
+#include <config_registry_test.h>
+#include <config_snapshot_test.h>
+#include <static_config_test.h>
 
 int main()
 {
     Kitsunemimi::ConfigHandler_Test configHandler_Test;
+    Kitsunemimi::ConfigSnapshot_Test configSnapshot_Test;
+    Kitsunemimi::StaticConfig_Test staticConfig_Test;
+    Kitsunemimi::ConfigCache_Test configCache_Test;
+    Kitsunemimi::ConfigRegistry_Test configRegistry_Test;
+    Kitsunemimi::ConfigBinding_Test configBinding_Test;
     return 0;
 }
@@ -0,0 +1,212 @@
+/**
+ *  @file       static_config_test.cpp
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#include "static_config_test.h"
+
+#include <libKitsunemimiConfig/static_config.h>
+#include <libKitsunemimiCommon/files/text_file.h>
+#include <libKitsunemimiCommon/methods/file_methods.h>
+
+namespace Kitsunemimi
+{
+
+struct TestSchema
+{
+    static constexpr StaticConfigEntry entries[] = {
+        staticString("DEFAULT", "string_val", "xyz"),
+        staticInteger("DEFAULT", "int_val", 42),
+        staticFloat("DEFAULT", "float_val", 42.0),
+        staticBoolean("DEFAULT", "bool_value", false),
+        staticStringArray("DEFAULT", "string_list"),
+        staticInteger("", "int_val2", 42),
+        staticString("other", "string_val", "default"),
+        staticDuration("DEFAULT", "timeout", std::chrono::seconds(5)),
+        staticByteSize("DEFAULT", "buffer", 4096),
+        staticDuration("other", "timeout", std::chrono::milliseconds(250)),
+        staticByteSize("other", "buffer", 1024),
+    };
+};
+
+struct BrokenSchema
+{
+    static constexpr StaticConfigEntry entries[] = {
+        staticString("DEFAULT", "string_val", "xyz"),
+        staticInteger("DEFAULT", "string_val", 42),
+    };
+};
+
+StaticConfig_Test::StaticConfig_Test()
+    : Kitsunemimi::CompareTestHelper("StaticConfig_Test")
+{
+    initTestCase();
+
+    findStaticConfigEntry_test();
+    initConfig_test();
+    getter_test();
+    updateConfig_test();
+
+    cleanupTestCase();
+}
+
+/**
+ * initTestCase
+ */
+void
+StaticConfig_Test::initTestCase()
+{
+    ErrorContainer error;
+    Kitsunemimi::writeFile(m_testFilePath, getTestString(), error, true);
+}
+
+/**
+ * @brief findStaticConfigEntry_test
+ */
+void
+StaticConfig_Test::findStaticConfigEntry_test()
+{
+    // resolved at compile-time
+    static_assert(STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "int_val") == 1);
+    static_assert(STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "int_val2") == 5);
+    static_assert(STATIC_CONFIG_INDEX(TestSchema, "other", "string_val") == 6);
+    static_assert(hasUniqueStaticConfigEntries(BrokenSchema::entries) == false);
+
+    TEST_EQUAL(STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "string_val"), 0);
+    TEST_EQUAL(STATIC_CONFIG_INDEX(TestSchema, "", "int_val2"), 5);
+    TEST_EQUAL(STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "fail"), 11);
+    TEST_EQUAL(countStaticConfigEntries(TestSchema::entries, ConfigHandler::INT_TYPE), 2);
+    TEST_EQUAL(countStaticConfigEntries(TestSchema::entries, ConfigHandler::STRING_TYPE), 2);
+    TEST_EQUAL(countStaticConfigEntries(TestSchema::entries, ConfigHandler::DURATION_TYPE), 2);
+    TEST_EQUAL(countStaticConfigEntries(TestSchema::entries, ConfigHandler::BYTE_SIZE_TYPE), 2);
+}
+
+/**
+ * @brief initConfig_test
+ */
+void
+StaticConfig_Test::initConfig_test()
+{
+    ErrorContainer error;
+
+    ConfigHandler configHandler;
+    configHandler.initConfig(m_testFilePath, error);
+    StaticConfig<TestSchema> staticConfig;
+    TEST_EQUAL(staticConfig.initConfig(configHandler, error), true);
+    TEST_EQUAL(configHandler.isConfigValid(), true);
+
+    // second registration of the same schema within the same handler must fail
+    StaticConfig<TestSchema> secondConfig;
+    TEST_EQUAL(secondConfig.initConfig(configHandler, error), false);
+    TEST_EQUAL(configHandler.isConfigValid(), false);
+}
+
+/**
+ * @brief getter_test
+ */
+void
+StaticConfig_Test::getter_test()
+{
+    ErrorContainer error;
+
+    ConfigHandler configHandler;
+    configHandler.initConfig(m_testFilePath, error);
+    StaticConfig<TestSchema> config;
+    config.initConfig(configHandler, error);
+
+    TEST_EQUAL(config.getString<STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "string_val")>(),
+               "asdf.asdf");
+    TEST_EQUAL(config.getInteger<STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "int_val")>(), 2);
+    TEST_EQUAL(config.getFloat<STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "float_val")>(), 123.0);
+    TEST_EQUAL(config.getBoolean<STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "bool_value")>(),
+               true);
+    TEST_EQUAL(config.getStringArray<STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "string_list")>()
+               .size(), 3);
+
+    // defaults
+    TEST_EQUAL(config.getInteger<STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "int_val2")>(), 42);
+    TEST_EQUAL(config.getString<STATIC_CONFIG_INDEX(TestSchema, "other", "string_val")>(),
+               "default");
+
+    // values with a unit
+    TEST_EQUAL(config.getDuration<STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "timeout")>().count(),
+               90000000000l);
+    TEST_EQUAL(config.getByteSize<STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "buffer")>(), 65536);
+    TEST_EQUAL(config.getDuration<STATIC_CONFIG_INDEX(TestSchema, "other", "timeout")>().count(),
+               250000000l);
+    TEST_EQUAL(config.getByteSize<STATIC_CONFIG_INDEX(TestSchema, "other", "buffer")>(), 1024);
+}
+
+/**
+ * @brief updateConfig_test
+ */
+void
+StaticConfig_Test::updateConfig_test()
+{
+    ErrorContainer error;
+    constexpr uint32_t intIndex = STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "int_val");
+
+    ConfigHandler configHandler;
+    configHandler.initConfig(m_testFilePath, error);
+    StaticConfig<TestSchema> config;
+    config.initConfig(configHandler, error);
+    configHandler.sealConfig();
+
+    // values are copies, which are not changed by a reload
+    std::string changedString = getTestString();
+    changedString.replace(changedString.find("int_val = 2"), 11, "int_val = 3");
+    Kitsunemimi::writeFile(m_testFilePath, changedString, error, true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(config.getInteger<intIndex>(), 2);
+
+    TEST_EQUAL(config.updateConfig(configHandler), true);
+    TEST_EQUAL(config.getInteger<intIndex>(), 3);
+    TEST_EQUAL(config.getByteSize<STATIC_CONFIG_INDEX(TestSchema, "DEFAULT", "buffer")>(), 65536);
+
+    // update within a subscription-callback sees the new values
+    long notifiedValue = 0;
+    configHandler.subscribeGroup("DEFAULT",
+                                 [&](const std::vector<ConfigChange> &)
+                                 {
+                                     config.updateConfig(configHandler);
+                                     notifiedValue = config.getInteger<intIndex>();
+                                 });
+    Kitsunemimi::writeFile(m_testFilePath, getTestString(), error, true);
+    TEST_EQUAL(configHandler.reloadConfig(error), true);
+    TEST_EQUAL(notifiedValue, 2);
+}
+
+/**
+ * cleanupTestCase
+ */
+void
+StaticConfig_Test::cleanupTestCase()
+{
+    ErrorContainer error;
+    Kitsunemimi::deleteFileOrDir(m_testFilePath, error);
+}
+
+/**
+ * @brief StaticConfig_Test::getTestString
+ * @return
+ */
+const std::string
+StaticConfig_Test::getTestString()
+{
+    const std::string testString(
+                "[DEFAULT]\n"
+                "string_val = asdf.asdf\n"
+                "int_val = 2\n"
+                "float_val = 123.0\n"
+                "string_list = a,b,c\n"
+                "bool_value = true\n"
+                "timeout = 1m30s\n"
+                "buffer = 64KiB\n"
+                "\n");
+    return testString;
+}
+
+} // namespace Kitsunemimi
@@ -0,0 +1,40 @@
+/**
+ *  @file       static_config_test.h
+ *
+ *  @author     Tobias Anker <tobias.anker@kitsunemimi.moe>
+ *
+ *  @copyright  MIT License
+ */
+
+#ifndef STATIC_CONFIG_TEST_H
+#define STATIC_CONFIG_TEST_H
+
+#include <libKitsunemimiCommon/test_helper/compare_test_helper.h>
+
+namespace Kitsunemimi
+{
+
+class StaticConfig_Test
+        : public Kitsunemimi::CompareTestHelper
+{
+public:
+    StaticConfig_Test();
+
+private:
+    void initTestCase();
+
+    void findStaticConfigEntry_test();
+    void initConfig_test();
+    void getter_test();
+    void updateConfig_test();
+
+    void cleanupTestCase();
+
+    const std::string getTestString();
+
+    std::string m_testFilePath = "/tmp/StaticConfig_Test.ini";
+};
+
+} // namespace Kitsunemimi
+
+#endif // STATIC_CONFIG_TEST_H
@@ -3,7 +3,7 @@ include(../../defaults.pri)
 QT -= qt core gui
 
 CONFIG   -= app_bundle
-CONFIG += c++17 console
+CONFIG += c++17 console thread
 
 LIBS += -L../../src -lKitsunemimiConfig
 
@@ -21,7 +21,19 @@ INCLUDEPATH += $$PWD
 
 SOURCES += \
     main.cpp \
-    config_handler_test.cpp
+    config_binding_test.cpp \
+    config_cache_test.cpp \
+    config_handler_test.cpp \
+    config_registry_test.cpp \
+    config_snapshot_test.cpp \
+    counting_allocator.cpp \
+    static_config_test.cpp
 
 HEADERS += \
-    config_handler_test.h
+    config_binding_test.h \
+    config_cache_test.h \
+    config_handler_test.h \
+    config_registry_test.h \
+    config_snapshot_test.h \
+    counting_allocator.h \
+    static_config_test.h